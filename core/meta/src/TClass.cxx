@@ -99,6 +99,8 @@ In order to access the name of a class within the ROOT type system, the method T
 #include <cassert>
 #include <vector>
 #include <memory>
+#include <string_view>
+#include <unordered_map>
 
 #include "TSpinLockGuard.h"
 
@@ -167,6 +169,62 @@ namespace {
      }
    };
 
+   // Incremented whenever a TClass is removed from the list of classes or
+   // unloaded, i.e. whenever a pointer previously returned by GetClass might
+   // become stale. The per-thread lookup caches below are flushed when they
+   // notice a new value.
+   std::atomic<UInt_t> gClassListGeneration{0};
+
+   // Number of TClass::GetClass calls that could not be served without taking
+   // the write lock on ROOT::gCoreMutex (see TClass::GetNumberOfLockedLookups).
+   std::atomic<ULong64_t> gNLockedLookups{0};
+
+   // Per-thread cache of the loaded TClasses already looked up by name or by
+   // typeid, so that repeated lookups of well-known classes do not need to
+   // take any lock. The name keys point to the TClass's own name.
+   struct TClassLookupCache {
+      UInt_t fGeneration = 0;
+      std::unordered_map<std::string_view, TClass *> fByName;
+      std::unordered_map<const std::type_info *, TClass *> fByTypeInfo;
+
+      void Sync()
+      {
+         UInt_t generation = gClassListGeneration.load(std::memory_order_acquire);
+         if (generation != fGeneration) {
+            fByName.clear();
+            fByTypeInfo.clear();
+            fGeneration = generation;
+         }
+      }
+   };
+
+   // Trivially destructible, so that they can still be inspected after the
+   // thread-local destructors ran (GetClass is called from static destructors).
+   thread_local TClassLookupCache *gClassLookupCache = nullptr;
+   thread_local bool gClassLookupCacheDeleted = false;
+
+   struct TClassLookupCacheOwner {
+      ~TClassLookupCacheOwner()
+      {
+         delete gClassLookupCache;
+         gClassLookupCache = nullptr;
+         gClassLookupCacheDeleted = true;
+      }
+   };
+
+   /// Return this thread's lookup cache, or nullptr once the thread is exiting.
+   TClassLookupCache *GetClassLookupCache()
+   {
+      if (!gClassLookupCache) {
+         if (gClassLookupCacheDeleted)
+            return nullptr;
+         thread_local TClassLookupCacheOwner owner;
+         gClassLookupCache = new TClassLookupCache;
+      }
+      gClassLookupCache->Sync();
+      return gClassLookupCache;
+   }
+
 }
 
 std::atomic<Int_t> TClass::fgClassCount;
@@ -522,6 +580,7 @@ void TClass::RemoveClass(TClass *oldcl)
    if (!oldcl) return;
 
    R__LOCKGUARD(gInterpreterMutex);
+   gClassListGeneration.fetch_add(1, std::memory_order_acq_rel);
    gROOT->GetListOfClasses()->Remove(oldcl);
    if (oldcl->GetTypeInfo()) {
       GetIdMap()->Remove(oldcl->GetTypeInfo()->name());
@@ -1659,6 +1718,9 @@ TClass::~TClass()
 {
    R__LOCKGUARD(gInterpreterMutex);
 
+   // Make sure no thread keeps on returning this TClass from its lookup cache.
+   gClassListGeneration.fetch_add(1, std::memory_order_acq_rel);
+
    // Remove from the typedef hashtables.
    if (fgClassTypedefHash && TestBit (kHasNameMapNode)) {
       TString resolvedThis = TClassEdit::ResolveTypedef (GetName(), kTRUE);
@@ -2978,6 +3040,14 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    if (!gROOT->GetListOfClasses())  return nullptr;
 
+   // Classes already found (loaded) by this thread are returned without
+   // taking any lock.
+   TClassLookupCache *cache = GetClassLookupCache();
+   if (cache) {
+      auto cached = cache->fByName.find(name);
+      if (cached != cache->fByName.end()) return cached->second;
+   }
+
    // FindObject will take the read lock before actually getting the
    // TClass pointer so we will need not get a partially initialized
    // object.
@@ -2985,8 +3055,13 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    // Early return to release the lock without having to execute the
    // long-ish normalization.
-   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) return cl;
+   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) {
+      if (cache && cl->IsLoaded() && !cl->TestBit(kUnloading) && strcmp(cl->GetName(), name) == 0)
+         cache->fByName.emplace(cl->GetName(), cl);
+      return cl;
+   }
 
+   ++gNLockedLookups;
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
    // Now that we got the write lock, another thread may have constructed the
@@ -3242,13 +3317,26 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    if (!gROOT->GetListOfClasses())
       return nullptr;
 
+   // Classes already found (loaded) by this thread are returned without
+   // taking any lock.
+   TClassLookupCache *cache = GetClassLookupCache();
+   if (cache) {
+      auto cached = cache->fByTypeInfo.find(&typeinfo);
+      if (cached != cache->fByTypeInfo.end()) return cached->second;
+   }
+
    //protect access to TROOT::GetIdMap
    R__READ_LOCKGUARD(ROOT::gCoreMutex);
 
    TClass* cl = GetIdMap()->Find(typeinfo.name());
 
-   if (cl && cl->IsLoaded()) return cl;
+   if (cl && cl->IsLoaded()) {
+      if (cache && !cl->TestBit(kUnloading))
+         cache->fByTypeInfo.emplace(&typeinfo, cl);
+      return cl;
+   }
 
+   ++gNLockedLookups;
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
    // Now that we got the write lock, another thread may have constructed the
@@ -3326,6 +3414,19 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    return cl; // Can be zero.
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of calls to GetClass(const char*) and
+/// GetClass(const std::type_info&) that had to take the global write lock,
+/// i.e. that could neither be served from the calling thread's cache of loaded
+/// classes nor from the list of classes under the read lock. A value growing
+/// with the number of processed events usually points to a lookup of a class
+/// that is not (or not yet) loaded and is a source of lock contention.
+
+ULong64_t TClass::GetNumberOfLockedLookups()
+{
+   return gNLockedLookups.load(std::memory_order_relaxed);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Static method returning pointer to TClass of the specified ClassInfo.
 /// If load is true an attempt is made to obtain the class by loading
@@ -6260,6 +6361,7 @@ void TClass::SetUnloaded()
       return;
    }
    SetBit(kUnloading);
+   gClassListGeneration.fetch_add(1, std::memory_order_acq_rel);
 
    //R__ASSERT(fState == kLoaded);
    if (fState != kLoaded) {
@@ -1,6 +1,12 @@
 #include "TClass.h"
 #include "THashTable.h"
 #include "TInterpreter.h"
+#include "TNamed.h"
+#include "TROOT.h"
+
+#include <thread>
+#include <typeinfo>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -22,3 +28,28 @@ TEST(TClass, DictCheck)
 
    EXPECT_STREQ(errMsg.c_str(), "Missing dictionary for C, ") << errMsg;
 }
+
+TEST(TClass, LookupOfLoadedClassesIsLockFree)
+{
+   ROOT::EnableThreadSafety();
+
+   TClass *byName = TClass::GetClass("TNamed");
+   TClass *byType = TClass::GetClass(typeid(TNamed));
+   ASSERT_NE(byName, nullptr);
+   EXPECT_EQ(byName, byType);
+
+   auto nLocked = TClass::GetNumberOfLockedLookups();
+   std::vector<std::thread> threads;
+   for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([byName]() {
+         for (int i = 0; i < 1000; ++i) {
+            EXPECT_EQ(TClass::GetClass("TNamed"), byName);
+            EXPECT_EQ(TClass::GetClass(typeid(TNamed)), byName);
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+
+   EXPECT_EQ(TClass::GetNumberOfLockedLookups(), nLocked);
+}
@@ -10,6 +10,8 @@
  *************************************************************************/
 #include "Compression.h"
 
+#include <cstddef>
+
 /**
  * These are definitions of various free functions for the C-style compression routines in ROOT.
  */
@@ -23,6 +25,28 @@ extern "C" unsigned long R__memcompress(char *tgt, unsigned long tgtsize, char *
 
 extern "C" void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues);
 
+/**
+ * Same as R__zipMultipleAlgorithm, but use the given zstd dictionary when the (resolved) algorithm is zstd.
+ * The same dictionary must be given to R__unzipWithDictionary to uncompress the buffer.
+ */
+extern "C" void R__zipMultipleAlgorithmWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues, const char *dict, int dictsize);
+
+/**
+ * Train a zstd dictionary of at most capacity bytes on nSamples buffers stored back to back in samples.
+ * Returns the size of the dictionary, or 0 if the training failed (e.g. too few or too small samples).
+ */
+extern "C" int R__zipTrainDictionary(const char *samples, const size_t *sampleSizes, unsigned nSamples, char *dict, int capacity);
+
+/**
+ * Same as R__unzip, but uncompress zstd buffers compressed with a dictionary using the given one.
+ */
+extern "C" void R__unzipWithDictionary(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep, const char *dict, int dictsize);
+
+/**
+ * Return the ID of the zstd dictionary needed to uncompress the buffer, or 0 if it needs none.
+ */
+extern "C" unsigned R__unzip_dictionary_id(int srcsize, unsigned char *src);
+
 /**
  * This is a historical definition, prior to ROOT supporting multiple algorithms in a single file.  Use
  * R__zipMultipleAlgorithm instead.
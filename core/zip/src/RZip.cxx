@@ -110,6 +110,34 @@ void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize,
   }
 }
 
+/* Same as R__zipMultipleAlgorithm, but compress with the given zstd dictionary if the resolved  */
+/* algorithm is zstd. The dictionary is ignored for the other algorithms or if dict is null.   */
+void R__zipMultipleAlgorithmWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                                           ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm,
+                                           const char *dict, int dictsize)
+{
+  if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kUseGlobal) {
+    compressionAlgorithm = R__ZipMode;
+  }
+
+  if (!dict || dictsize <= 0 || compressionAlgorithm != ROOT::RCompressionSetting::EAlgorithm::kZSTD) {
+    R__zipMultipleAlgorithm(cxlevel, srcsize, src, tgtsize, tgt, irep, compressionAlgorithm);
+    return;
+  }
+
+  if (*srcsize < 1 + HDRSIZE + 1 || cxlevel <= 0) {
+    *irep = 0;
+    return;
+  }
+
+  R__zipZSTDWithDictionary(cxlevel, srcsize, src, tgtsize, tgt, irep, dict, dictsize);
+}
+
+int R__zipTrainDictionary(const char *samples, const size_t *sampleSizes, unsigned nSamples, char *dict, int capacity)
+{
+  return R__ZSTDTrainDictionary(samples, sampleSizes, nSamples, dict, capacity);
+}
+
   // The very old algorithm for backward compatibility
   // 0 for selecting with R__ZipMode in a backward compatible way
   // 3 for selecting in other cases
@@ -299,6 +327,15 @@ int R__unzip_header(int *srcsize, uch *src, int *tgtsize)
   return 0;
 }
 
+/* Return the ID of the zstd dictionary needed to uncompress the buffer, 0 if none is needed. */
+unsigned R__unzip_dictionary_id(int srcsize, unsigned char *src)
+{
+  if (srcsize < HDRSIZE || !is_valid_header_zstd(src)) {
+    return 0;
+  }
+  return R__ZSTDGetDictionaryID(srcsize, src);
+}
+
 
 /***********************************************************************
  *                                                                     *
@@ -320,6 +357,12 @@ int R__unzip_header(int *srcsize, uch *src, int *tgtsize)
 // N.B. (Brian) - I have kept the original note out of complete awe of the
 // age of the original code...
 void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
+{
+   R__unzipWithDictionary(srcsize, src, tgtsize, tgt, irep, nullptr, 0);
+}
+
+/* Same as R__unzip; dict (of size dictsize) is used for the zstd buffers compressed with a dictionary. */
+void R__unzipWithDictionary(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep, const char *dict, int dictsize)
 {
    long isize;
    uch *ibufptr, *obufptr;
@@ -367,7 +410,7 @@ void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
       R__unzipLZ4(srcsize, src, tgtsize, tgt, irep);
       return;
    } else if (is_valid_header_zstd(src)) {
-      R__unzipZSTD(srcsize, src, tgtsize, tgt, irep);
+      R__unzipZSTDWithDictionary(srcsize, src, tgtsize, tgt, irep, dict, dictsize);
       return;
    }
 
@@ -12,11 +12,26 @@
 
 // NOTE: the ROOT compression libraries aren't consistently written in C++; hence the
 // #ifdef's to avoid problems with C code.
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+
+// Compression with a zstd dictionary. The dictionary ID is stored in the zstd frame: the same dictionary must be
+// given to R__unzipZSTDWithDictionary to uncompress the resulting buffer.
+void R__zipZSTDWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                              const char *dict, int dictsize);
+void R__unzipZSTDWithDictionary(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep,
+                                const char *dict, int dictsize);
+// Return the ID of the dictionary needed to uncompress the buffer, or 0 if it was compressed without one.
+unsigned R__ZSTDGetDictionaryID(int srcsize, unsigned char *src);
+// Train a dictionary of at most `capacity` bytes on the nSamples buffers concatenated in `samples`;
+// returns the size of the dictionary or 0 if the training failed.
+int R__ZSTDTrainDictionary(const char *samples, const size_t *sampleSizes, unsigned nSamples, char *dict,
+                           int capacity);
 #ifdef __cplusplus
 }
 #endif
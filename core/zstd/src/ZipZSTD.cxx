@@ -14,7 +14,10 @@
 
 #include "zdict.h"
 #include <zstd.h>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <iostream>
 
@@ -22,17 +25,96 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
-void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+namespace {
+
+using CCtx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
+using DCtx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
+using CDict_ptr = std::unique_ptr<ZSTD_CDict, decltype(&ZSTD_freeCDict)>;
+using DDict_ptr = std::unique_ptr<ZSTD_DDict, decltype(&ZSTD_freeDDict)>;
+
+/// Compression and decompression contexts are expensive to create compared to the compression of a small
+/// buffer; keep one of each per thread.
+ZSTD_CCtx *GetThreadCCtx()
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
-    Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+   thread_local CCtx_ptr ctx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+   return ctx.get();
+}
+
+ZSTD_DCtx *GetThreadDCtx()
+{
+   thread_local DCtx_ptr ctx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+   return ctx.get();
+}
 
+/// Digested dictionaries are expensive to create compared to the (de)compression of a small buffer. Each
+/// thread keeps the last few it used; an entry is reused only if the content of the dictionary (and the
+/// compression level, for compression) matches, so the dictionary given by the caller is always the one used.
+struct DictionaryCache {
+   static constexpr std::size_t kMaxEntries = 16;
+
+   struct Entry {
+      std::string fContent;
+      int fLevel = 0;
+      CDict_ptr fCDict{nullptr, &ZSTD_freeCDict};
+      DDict_ptr fDDict{nullptr, &ZSTD_freeDDict};
+   };
+   std::vector<Entry> fEntries;
+
+   static DictionaryCache &ThreadInstance()
+   {
+      thread_local DictionaryCache cache;
+      return cache;
+   }
+
+   Entry &GetEntry(const char *dict, int dictsize, int level)
+   {
+      for (auto &entry : fEntries) {
+         if (entry.fLevel == level && entry.fContent.size() == static_cast<size_t>(dictsize) &&
+             memcmp(entry.fContent.data(), dict, dictsize) == 0)
+            return entry;
+      }
+      if (fEntries.size() >= kMaxEntries)
+         fEntries.erase(fEntries.begin());
+      fEntries.emplace_back();
+      fEntries.back().fContent.assign(dict, static_cast<size_t>(dictsize));
+      fEntries.back().fLevel = level;
+      return fEntries.back();
+   }
+
+   const ZSTD_CDict *GetCDict(const char *dict, int dictsize, int level)
+   {
+      auto &entry = GetEntry(dict, dictsize, level);
+      if (!entry.fCDict)
+         entry.fCDict.reset(ZSTD_createCDict(dict, static_cast<size_t>(dictsize), level));
+      return entry.fCDict.get();
+   }
+
+   const ZSTD_DDict *GetDDict(const char *dict, int dictsize)
+   {
+      // Decompression does not depend on the level; -1 keeps these entries apart from the compression ones.
+      auto &entry = GetEntry(dict, dictsize, -1);
+      if (!entry.fDDict)
+         entry.fDDict.reset(ZSTD_createDDict(dict, static_cast<size_t>(dictsize)));
+      return entry.fDDict.get();
+   }
+};
+
+void R__zipZSTDImpl(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, const ZSTD_CDict *cdict)
+{
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+    size_t retval;
+    if (cdict) {
+       retval = ZSTD_compress_usingCDict(GetThreadCCtx(),
+                                         &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                         src, static_cast<size_t>(*srcsize),
+                                         cdict);
+    } else {
+       retval = ZSTD_compressCCtx(GetThreadCCtx(),
+                                  &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                  src, static_cast<size_t>(*srcsize),
+                                  2*cxlevel);
+    }
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -58,10 +140,48 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
     tgt[8] = (inflate_size >> 16) & 0xff;
 }
 
+} // anonymous namespace
+
+void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
+    R__zipZSTDImpl(cxlevel, srcsize, src, tgtsize, tgt, irep, nullptr);
+}
+
+void R__zipZSTDWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                              const char *dict, int dictsize)
+{
+    const ZSTD_CDict *cdict = nullptr;
+    if (dict && dictsize > 0)
+       cdict = DictionaryCache::ThreadInstance().GetCDict(dict, dictsize, 2*cxlevel);
+    R__zipZSTDImpl(cxlevel, srcsize, src, tgtsize, tgt, irep, cdict);
+}
+
+unsigned R__ZSTDGetDictionaryID(int srcsize, unsigned char *src)
+{
+    if (srcsize <= kHeaderSize)
+       return 0;
+    return ZSTD_getDictID_fromFrame(&src[kHeaderSize], static_cast<size_t>(srcsize - kHeaderSize));
+}
+
+int R__ZSTDTrainDictionary(const char *samples, const size_t *sampleSizes, unsigned nSamples, char *dict,
+                           int capacity)
+{
+    if (!samples || !sampleSizes || nSamples == 0 || !dict || capacity <= 0)
+       return 0;
+    size_t retval = ZDICT_trainFromBuffer(dict, static_cast<size_t>(capacity), samples, sampleSizes, nSamples);
+    if (ZDICT_isError(retval))
+       return 0;
+    return static_cast<int>(retval);
+}
+
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
-    Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    R__unzipZSTDWithDictionary(srcsize, src, tgtsize, tgt, irep, nullptr, 0);
+}
+
+void R__unzipZSTDWithDictionary(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep,
+                                const char *dict, int dictsize)
+{
     *irep = 0;
 
     if (R__unlikely(src[0] != 'Z' || src[1] != 'S')) {
@@ -77,9 +197,30 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    const size_t frameSize = static_cast<size_t>(*srcsize - kHeaderSize);
+    const unsigned dictID = ZSTD_getDictID_fromFrame(&src[kHeaderSize], frameSize);
+
+    size_t retval;
+    if (dictID != 0) {
+       if (R__unlikely(!dict || dictsize <= 0 || ZDICT_getDictID(dict, static_cast<size_t>(dictsize)) != dictID)) {
+          std::cerr << "R__unzipZSTD: the buffer was compressed with the dictionary " << dictID
+                    << " which was not provided." << std::endl;
+          return;
+       }
+       const ZSTD_DDict *ddict = DictionaryCache::ThreadInstance().GetDDict(dict, dictsize);
+       if (R__unlikely(!ddict)) {
+          std::cerr << "R__unzipZSTD: invalid dictionary " << dictID << "." << std::endl;
+          return;
+       }
+       retval = ZSTD_decompress_usingDDict(GetThreadDCtx(),
+                                           (char *)tgt, static_cast<size_t>(*tgtsize),
+                                           (char *)&src[kHeaderSize], frameSize,
+                                           ddict);
+    } else {
+       retval = ZSTD_decompressDCtx(GetThreadDCtx(),
+                                    (char *)tgt, static_cast<size_t>(*tgtsize),
+                                    (char *)&src[kHeaderSize], frameSize);
+    }
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
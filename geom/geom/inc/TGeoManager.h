@@ -40,6 +40,7 @@ class TGDMLMatrix;
 class TGeoOpticalSurface;
 class TGeoSkinSurface;
 class TGeoBorderSurface;
+class TGeoNavigatorPool;
 
 class TGeoManager : public TNamed
 {
@@ -121,6 +122,7 @@ private :
    typedef std::map<std::string, Double_t>                   ConstPropMap_t;
 
    NavigatorsMap_t       fNavigators;       //! Map between thread id's and navigator arrays
+   TGeoNavigatorPool    *fNavigatorPool;    //! Navigators pre-allocated by PrepareNavigators()
    static ThreadsMap_t  *fgThreadId;        //! Thread id's map
    static Int_t          fgNumThreads;      //! Number of registered threads
    static Bool_t         fgLockNavigators;   //! Lock existing navigators
@@ -439,6 +441,11 @@ public:
    void                   ClearNavigators();
    void                   RemoveMaterial(Int_t index);
    void                   RemoveNavigator(const TGeoNavigator *nav);
+
+   //--- lock-free pool of navigators for worker threads
+   void                   PrepareNavigators(Int_t nnavigators);
+   TGeoNavigator         *AcquireNavigator();
+   void                   ReleaseNavigator(TGeoNavigator *nav);
    void                   ResetUserData();
 
 
@@ -16,6 +16,10 @@
 
 #include "TGeoCache.h"
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 ////////////////////////////////////////////////////////////////////////////
 //                                                                        //
 // TGeoNavigator - Class containing the implementation of all navigation  //
@@ -83,6 +87,7 @@ private :
    TGeoHMatrix          *fGlobalMatrix;     //! current pointer to cached global matrix
    TGeoHMatrix          *fDivMatrix;        //! current local matrix of the selected division cell
    TString               fPath;             //! path to current node
+   std::unordered_map<std::string, std::vector<Int_t>> fPathCache; //! daughter indices along the paths already visited by cd()
 
 public :
    TGeoNavigator();
@@ -109,6 +114,10 @@ public :
    TGeoNode              *FindNextBoundaryAndStep(Double_t stepmax=TGeoShape::Big(), Bool_t compsafe=kFALSE);
    TGeoNode              *FindNode(Bool_t safe_start=kTRUE);
    TGeoNode              *FindNode(Double_t x, Double_t y, Double_t z);
+   //--- basket queries for tracks inside the current volume, in its local frame
+   void                   FindNextBoundary_v(Int_t ntracks, const Double_t *points, const Double_t *dirs, const Double_t *stepmax,
+                                             Double_t *steps, Int_t *idaughters, Double_t *safeties=nullptr);
+   void                   FindNode_v(Int_t ntracks, const Double_t *points, Int_t *idaughters);
    Double_t              *FindNormal(Bool_t forward=kTRUE);
    Double_t              *FindNormalFast();
    TGeoNode              *InitTrack(const Double_t *point, const Double_t *dir);
@@ -234,9 +234,14 @@ in order to enhance rays.
 \image html geom_random2.jpg
 */
 
+#include <atomic>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
 
 #include "TROOT.h"
 #include "TGeoManager.h"
@@ -303,6 +308,87 @@ TGeoManager::EDefaultUnits TGeoManager::fgDefaultUnits = TGeoManager::kRootUnits
 TGeoManager::ThreadsMap_t *TGeoManager::fgThreadId = 0;
 static Bool_t gGeometryLocked = kTRUE;
 
+////////////////////////////////////////////////////////////////////////////////
+/// Navigators pre-allocated by TGeoManager::PrepareNavigators() and handed out
+/// to worker threads without locking. Each slot sits on its own cache line, so
+/// that threads acquiring and releasing different navigators do not contend.
+
+class TGeoNavigatorPool {
+public:
+   struct alignas(64) Slot_t {
+      std::atomic<Bool_t> fBusy{kFALSE}; // slot handed out to a thread
+      TGeoNavigator      *fNavigator{nullptr};
+   };
+
+   Int_t                      fSize;
+   std::unique_ptr<Slot_t[]>  fSlots;
+
+   TGeoNavigatorPool(TGeoManager *geom, Int_t size) : fSize(size), fSlots(new Slot_t[size])
+   {
+      for (Int_t i = 0; i < fSize; i++) {
+         TGeoNavigator *nav = new TGeoNavigator(geom);
+         nav->BuildCache(kTRUE, kFALSE);
+         nav->GetCache()->BuildInfoBranch();
+         fSlots[i].fNavigator = nav;
+      }
+   }
+   ~TGeoNavigatorPool()
+   {
+      for (Int_t i = 0; i < fSize; i++) delete fSlots[i].fNavigator;
+   }
+
+   /// Hand out a free navigator, starting the search at a slot depending on the
+   /// calling thread so that threads do not all compete for the first slots.
+   TGeoNavigator *Acquire()
+   {
+      Int_t start = std::hash<std::thread::id>()(std::this_thread::get_id()) % fSize;
+      for (Int_t i = 0; i < fSize; i++) {
+         Slot_t &slot = fSlots[(start + i) % fSize];
+         Bool_t expected = kFALSE;
+         if (!slot.fBusy.load(std::memory_order_relaxed) &&
+             slot.fBusy.compare_exchange_strong(expected, kTRUE, std::memory_order_acquire))
+            return slot.fNavigator;
+      }
+      return nullptr;
+   }
+
+   Bool_t Release(const TGeoNavigator *nav)
+   {
+      for (Int_t i = 0; i < fSize; i++) {
+         if (fSlots[i].fNavigator == nav) {
+            fSlots[i].fBusy.store(kFALSE, std::memory_order_release);
+            return kTRUE;
+         }
+      }
+      return kFALSE;
+   }
+
+   Bool_t IsBusy() const
+   {
+      for (Int_t i = 0; i < fSize; i++)
+         if (fSlots[i].fBusy.load()) return kTRUE;
+      return kFALSE;
+   }
+};
+
+namespace {
+// Navigator acquired from the pool of a geometry by the calling thread
+struct TGeoPoolNavigator_t {
+   const TGeoManager *fGeometry;
+   TGeoNavigator     *fNavigator;
+};
+// Navigators held by the calling thread, the last acquired one at the back. A thread
+// may hold several navigators, of the same or of different geometries, at a time.
+thread_local std::vector<TGeoPoolNavigator_t> gPoolNavigators;
+
+TGeoNavigator *FindPoolNavigator(const TGeoManager *geom)
+{
+   for (auto it = gPoolNavigators.rbegin(); it != gPoolNavigators.rend(); ++it)
+      if (it->fGeometry == geom) return it->fNavigator;
+   return nullptr;
+}
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor.
 
@@ -382,6 +468,7 @@ TGeoManager::TGeoManager()
       fMaxThreads = 0;
       fUsePWNav = kFALSE;
       fParallelWorld = 0;
+      fNavigatorPool = 0;
       ClearThreadsMap();
    } else {
       Init();
@@ -488,6 +575,7 @@ void TGeoManager::Init()
    fMaxThreads = 0;
    fUsePWNav = kFALSE;
    fParallelWorld = 0;
+   fNavigatorPool = 0;
    ClearThreadsMap();
 }
 
@@ -534,6 +622,7 @@ TGeoManager::~TGeoManager()
    if (fSkinSurfaces) {fSkinSurfaces->Delete(); SafeDelete( fSkinSurfaces );}
    if (fBorderSurfaces) {fBorderSurfaces->Delete(); SafeDelete( fBorderSurfaces );}
    ClearNavigators();
+   delete fNavigatorPool;
    CleanGarbage();
    SafeDelete( fPainter );
    SafeDelete( fGLMatrix );
@@ -739,6 +828,10 @@ TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 {
    TTHREAD_TLS(TGeoNavigator*) tnav = 0;
    if (!fMultiThread) return fCurrentNavigator;
+   if (!gPoolNavigators.empty()) {
+      TGeoNavigator *poolnav = FindPoolNavigator(this);
+      if (poolnav) return poolnav;
+   }
    TGeoNavigator *nav = tnav; // TTHREAD_TLS_GET(TGeoNavigator*,tnav);
    if (nav) return nav;
    std::thread::id threadId = std::this_thread::get_id();
@@ -830,6 +923,76 @@ void TGeoManager::RemoveNavigator(const TGeoNavigator *nav)
    if (fMultiThread) fgMutex.unlock();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Pre-allocate a pool of nnavigators navigators, with their state caches, to be
+/// handed out to worker threads by AcquireNavigator(). The geometry must be
+/// closed; if it is not yet in multi-threaded mode, SetMaxThreads(nnavigators)
+/// is called. A previous pool is replaced, provided none of its navigators is
+/// still in use.
+
+void TGeoManager::PrepareNavigators(Int_t nnavigators)
+{
+   if (!fClosed) {
+      Error("PrepareNavigators", "Cannot prepare navigators before closing the geometry");
+      return;
+   }
+   if (nnavigators <= 0) {
+      Error("PrepareNavigators", "Invalid number of navigators: %d", nnavigators);
+      return;
+   }
+   if (!fMultiThread) SetMaxThreads(nnavigators);
+   std::lock_guard<std::mutex> lock(fgMutex);
+   if (fNavigatorPool) {
+      if (fNavigatorPool->IsBusy()) {
+         Error("PrepareNavigators", "Navigators of the current pool are still in use");
+         return;
+      }
+      delete fNavigatorPool;
+   }
+   fNavigatorPool = new TGeoNavigatorPool(this, nnavigators);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Hand out a navigator of the pool created by PrepareNavigators() to the
+/// calling thread, without locking. The navigator becomes the current navigator
+/// of the thread until it is given back with ReleaseNavigator(). A thread may
+/// acquire several navigators: the last one acquired and not yet released is
+/// its current navigator. Returns 0 if all the navigators of the pool are in use.
+
+TGeoNavigator *TGeoManager::AcquireNavigator()
+{
+   if (!fNavigatorPool) {
+      Error("AcquireNavigator", "No navigator pool, call PrepareNavigators first");
+      return 0;
+   }
+   TGeoNavigator *nav = fNavigatorPool->Acquire();
+   if (!nav) {
+      Error("AcquireNavigator", "All the %d navigators of the pool are in use", fNavigatorPool->fSize);
+      return 0;
+   }
+   gPoolNavigators.push_back({this, nav});
+   return nav;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Give back to the pool a navigator obtained with AcquireNavigator(), from the
+/// thread that acquired it. Its state is kept, so that it can be reused by the
+/// next thread without reallocation.
+
+void TGeoManager::ReleaseNavigator(TGeoNavigator *nav)
+{
+   if (!fNavigatorPool || !fNavigatorPool->Release(nav)) {
+      Error("ReleaseNavigator", "Navigator %p does not belong to the pool", (void*)nav);
+      return;
+   }
+   for (auto it = gPoolNavigators.rbegin(); it != gPoolNavigators.rend(); ++it) {
+      if (it->fNavigator == nav) {
+         gPoolNavigators.erase(std::next(it).base());
+         break;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set maximum number of threads for navigation.
 
@@ -33,6 +33,7 @@ gGeoManager->SetCurrentNavigator(0);
 
 #include "TGeoNavigator.h"
 
+#include "TGeoBBox.h"
 #include "TGeoManager.h"
 #include "TGeoMatrix.h"
 #include "TGeoNode.h"
@@ -43,6 +44,11 @@ gGeoManager->SetCurrentNavigator(0);
 #include "TGeoParallelWorld.h"
 #include "TGeoPhysicalNode.h"
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
 static Double_t gTolerance = TGeoShape::Tolerance();
 const char *kGeoOutsidePath = " ";
 const Int_t kN3 = 3*sizeof(Double_t);
@@ -201,6 +207,18 @@ Bool_t TGeoNavigator::cd(const char *path)
 {
    CdTop();
    if (!path[0]) return kTRUE;
+   // Once the geometry is closed the daughter indices along a path do not change
+   // anymore, so the parsing and the search of the nodes by name are done only
+   // the first time a path is visited by this navigator.
+   const Bool_t useCache = fGeometry->IsClosed();
+   if (useCache) {
+      auto cached = fPathCache.find(path);
+      if (cached != fPathCache.end()) {
+         for (Int_t index : cached->second) CdDown(index);
+         return kTRUE;
+      }
+   }
+   std::vector<Int_t> indices;
    TString spath = path;
    TGeoVolume *vol;
    Int_t length = spath.Length();
@@ -231,9 +249,15 @@ Bool_t TGeoNavigator::cd(const char *path)
          Error("cd", "Path %s not valid", path);
          return kFALSE;
       }
-      CdDown(vol->GetIndex(node));
+      indices.push_back(vol->GetIndex(node));
+      CdDown(indices.back());
       ind1 = ind2;
    }
+   if (useCache) {
+      // Bound the memory used by navigators visiting many different paths
+      if (fPathCache.size() >= 65536) fPathCache.clear();
+      fPathCache.emplace(path, std::move(indices));
+   }
    return kTRUE;
 }
 
@@ -1114,6 +1138,164 @@ TGeoNode *TGeoNavigator::FindNextDaughterBoundary(Double_t *point, Double_t *dir
    return nodefound;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Basket version of FindNextBoundary() for ntracks tracks located inside the
+/// current volume. Points and directions are given in the local frame of the
+/// current volume, 3 consecutive values per track. For each track, the distance
+/// to the next boundary, limited to stepmax[i], is stored in steps[i] and the
+/// index of the daughter entered at that boundary in idaughters[i] (-1 if the
+/// track leaves the current volume or does not reach a boundary within
+/// stepmax[i]). If safeties is not null, the safety distance of each track
+/// is stored as well. The state of the navigator is not changed and the
+/// daughters of the current volume are assumed not to overlap.
+///
+/// The work is done shape by shape for all the tracks rather than track by
+/// track, using the vector methods of the shapes (TGeoShape::DistFromInside_v,
+/// DistFromOutside_v and Safety_v). When the current volume is voxelized, the
+/// bounding boxes of the daughters are checked first for the whole basket and
+/// a daughter is only processed for the tracks that can reach it.
+
+void TGeoNavigator::FindNextBoundary_v(Int_t ntracks, const Double_t *points, const Double_t *dirs,
+                                       const Double_t *stepmax, Double_t *steps, Int_t *idaughters,
+                                       Double_t *safeties)
+{
+   if (ntracks <= 0) return;
+   TGeoVolume *vol = GetCurrentVolume();
+   if (vol->IsAssembly()) {
+      Error("FindNextBoundary_v", "The current volume %s is an assembly", vol->GetName());
+      return;
+   }
+   std::vector<Double_t> step(stepmax, stepmax + ntracks);
+   std::unique_ptr<Bool_t[]> inside(new Bool_t[ntracks]);
+   for (Int_t i = 0; i < ntracks; i++) inside[i] = kTRUE;
+
+   //---> distance and safety to the boundary of the current volume
+   vol->GetShape()->DistFromInside_v(points, dirs, steps, ntracks, step.data());
+   for (Int_t i = 0; i < ntracks; i++) {
+      if (steps[i] > stepmax[i]) steps[i] = stepmax[i];
+      idaughters[i] = -1;
+   }
+   if (safeties) vol->GetShape()->Safety_v(points, inside.get(), safeties, ntracks);
+
+   Int_t nd = vol->GetNdaughters();
+   if (!nd) return;
+   TGeoVoxelFinder *voxels = vol->GetVoxels();
+   if (voxels && voxels->NeedRebuild()) {
+      voxels->Voxelize();
+      vol->FindOverlaps();
+   }
+   Double_t *boxes = voxels ? voxels->GetBoxes() : nullptr;
+   for (Int_t i = 0; i < ntracks; i++) inside[i] = kFALSE;
+
+   std::vector<Int_t> selected(ntracks);
+   std::vector<Double_t> lpoints(3*ntracks), ldirs(3*ntracks), dist(ntracks), bstep(ntracks);
+   for (Int_t id = 0; id < nd; id++) {
+      TGeoNode *node = vol->GetNode(id);
+      TGeoMatrix *mat = node->GetMatrix();
+      TGeoShape *shape = node->GetVolume()->GetShape();
+      const Double_t *box = boxes ? &boxes[6*id] : nullptr;
+
+      //---> safety: the bounding box of the daughter gives a lower bound
+      if (safeties) {
+         Int_t nsel = 0;
+         for (Int_t i = 0; i < ntracks; i++) {
+            Double_t safbox = -TGeoShape::Big();
+            if (box) {
+               const Double_t *point = &points[3*i];
+               safbox = std::max(std::abs(point[0]-box[3])-box[0],
+                                 std::max(std::abs(point[1]-box[4])-box[1], std::abs(point[2]-box[5])-box[2]));
+            }
+            selected[nsel] = i;
+            nsel += (safbox < safeties[i]);
+         }
+         for (Int_t k = 0; k < nsel; k++) mat->MasterToLocal(&points[3*selected[k]], &lpoints[3*k]);
+         shape->Safety_v(lpoints.data(), inside.get(), dist.data(), nsel);
+         for (Int_t k = 0; k < nsel; k++) {
+            Int_t i = selected[k];
+            if (dist[k] < safeties[i]) safeties[i] = dist[k];
+         }
+      }
+
+      //---> distance: only tracks that hit the bounding box before their current step
+      Int_t nsel = 0;
+      for (Int_t i = 0; i < ntracks; i++) {
+         Double_t sbox = 0.;
+         if (box) sbox = TGeoBBox::DistFromOutside(&points[3*i], &dirs[3*i], box[0], box[1], box[2], &box[3], steps[i]);
+         selected[nsel] = i;
+         nsel += (sbox < steps[i]);
+      }
+      for (Int_t k = 0; k < nsel; k++) {
+         Int_t i = selected[k];
+         mat->MasterToLocal(&points[3*i], &lpoints[3*k]);
+         mat->MasterToLocalVect(&dirs[3*i], &ldirs[3*k]);
+         bstep[k] = steps[i];
+      }
+      shape->DistFromOutside_v(lpoints.data(), ldirs.data(), dist.data(), nsel, bstep.data());
+      for (Int_t k = 0; k < nsel; k++) {
+         Int_t i = selected[k];
+         if (dist[k] < steps[i]) {
+            steps[i] = dist[k];
+            idaughters[i] = id;
+         }
+      }
+   }
+   if (safeties) {
+      for (Int_t i = 0; i < ntracks; i++)
+         if (safeties[i] < 0) safeties[i] = 0.;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Basket version of the daughter search done by FindNode() for ntracks points
+/// located inside the current volume, given in its local frame (3 consecutive
+/// values per point). The index of the daughter containing each point is stored
+/// in idaughters[i], -1 if the point is in the current volume itself. The
+/// daughters of the current volume are assumed not to overlap and the state of
+/// the navigator is not changed.
+
+void TGeoNavigator::FindNode_v(Int_t ntracks, const Double_t *points, Int_t *idaughters)
+{
+   if (ntracks <= 0) return;
+   for (Int_t i = 0; i < ntracks; i++) idaughters[i] = -1;
+   TGeoVolume *vol = GetCurrentVolume();
+   Int_t nd = vol->GetNdaughters();
+   if (!nd) return;
+   TGeoVoxelFinder *voxels = vol->GetVoxels();
+   if (voxels && voxels->NeedRebuild()) {
+      voxels->Voxelize();
+      vol->FindOverlaps();
+   }
+   Double_t *boxes = voxels ? voxels->GetBoxes() : nullptr;
+
+   std::vector<Int_t> selected(ntracks);
+   std::vector<Double_t> lpoints(3*ntracks);
+   std::unique_ptr<Bool_t[]> inside(new Bool_t[ntracks]);
+   Int_t nleft = ntracks;
+   for (Int_t id = 0; id < nd && nleft; id++) {
+      TGeoNode *node = vol->GetNode(id);
+      const Double_t *box = boxes ? &boxes[6*id] : nullptr;
+      Int_t nsel = 0;
+      for (Int_t i = 0; i < ntracks; i++) {
+         Bool_t candidate = idaughters[i] < 0;
+         if (box) {
+            const Double_t *point = &points[3*i];
+            candidate = candidate && (std::abs(point[0]-box[3]) <= box[0]) && (std::abs(point[1]-box[4]) <= box[1]) &&
+                        (std::abs(point[2]-box[5]) <= box[2]);
+         }
+         selected[nsel] = i;
+         nsel += candidate;
+      }
+      for (Int_t k = 0; k < nsel; k++) node->GetMatrix()->MasterToLocal(&points[3*selected[k]], &lpoints[3*k]);
+      node->GetVolume()->GetShape()->Contains_v(lpoints.data(), inside.get(), nsel);
+      for (Int_t k = 0; k < nsel; k++) {
+         if (inside[k]) {
+            idaughters[selected[k]] = id;
+            nleft--;
+         }
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute distance to next boundary within STEPMAX. If no boundary is found,
 /// propagate current point along current direction with fStep=STEPMAX. Otherwise
@@ -36,6 +36,8 @@ End_Macro
 
 */
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 #include "TGeoManager.h"
@@ -782,10 +784,37 @@ void TGeoTrd2::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute distance from array of input points having directions specified by dirs. Store output in dists
-
-void TGeoTrd2::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
-{
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+/// Same result as DistFromInside for each point, written without branches so that the compiler can
+/// vectorize the loop.
+
+void TGeoTrd2::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* /*step*/) const
+{
+   const Double_t big = TGeoShape::Big();
+   const Double_t fx = 0.5*(fDx1-fDx2)/fDz;
+   const Double_t fy = 0.5*(fDy1-fDy2)/fDz;
+   for (Int_t i=0; i<vecsize; i++) {
+      const Double_t *point = &points[3*i];
+      const Double_t *dir = &dirs[3*i];
+      // Z facettes
+      const Double_t sz = (dir[2]!=0) ? (std::copysign(fDz, dir[2])-point[2])/dir[2] : big;
+      // X facettes
+      const Double_t distx = 0.5*(fDx1+fDx2)-fx*point[2];
+      const Double_t cnx1 = -dir[0]+fx*dir[2];
+      const Double_t cnx2 = dir[0]+fx*dir[2];
+      const Double_t sx1 = point[0]+distx;
+      const Double_t sx2 = distx-point[0];
+      const Bool_t zeroX = ((cnx1>0) && (sx1<=0)) || ((cnx2>0) && (sx2<=0));
+      const Double_t sx = std::min((cnx1>0) ? sx1/cnx1 : big, (cnx2>0) ? sx2/cnx2 : big);
+      // Y facettes
+      const Double_t disty = 0.5*(fDy1+fDy2)-fy*point[2];
+      const Double_t cny1 = -dir[1]+fy*dir[2];
+      const Double_t cny2 = dir[1]+fy*dir[2];
+      const Double_t sy1 = point[1]+disty;
+      const Double_t sy2 = disty-point[1];
+      const Bool_t zeroY = ((cny1>0) && (sy1<=0)) || ((cny2>0) && (sy2<=0));
+      const Double_t sy = std::min((cny1>0) ? sy1/cny1 : big, (cny2>0) ? sy2/cny2 : big);
+      dists[i] = ((sz<=0) || zeroX || zeroY) ? 0. : std::min(sz, std::min(sx, sy));
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -800,8 +829,23 @@ void TGeoTrd2::DistFromOutside_v(const Double_t *points, const Double_t *dirs, D
 /// Compute safe distance from each of the points in the input array.
 /// Input: Array of point coordinates, array of statuses for these points, size of the arrays
 /// Output: Safety values
+/// Same result as Safety for each point, written without branches so that the compiler can
+/// vectorize the loop.
 
 void TGeoTrd2::Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const
 {
-   for (Int_t i=0; i<vecsize; i++) safe[i] = Safety(&points[3*i], inside[i]);
+   const Double_t big = TGeoShape::Big();
+   const Double_t fx = 0.5*(fDx1-fDx2)/fDz;
+   const Double_t calfx = 1./TMath::Sqrt(1.0+fx*fx);
+   const Double_t fy = 0.5*(fDy1-fDy2)/fDz;
+   const Double_t calfy = 1./TMath::Sqrt(1.0+fy*fy);
+   for (Int_t i=0; i<vecsize; i++) {
+      const Double_t *point = &points[3*i];
+      const Double_t distx = 0.5*(fDx1+fDx2)-fx*point[2];
+      const Double_t safx = (distx<0) ? big : (distx-std::abs(point[0]))*calfx;
+      const Double_t disty = 0.5*(fDy1+fDy2)-fy*point[2];
+      const Double_t safy = (disty<0) ? big : (disty-std::abs(point[1]))*calfy;
+      const Double_t safmin = std::min(fDz-std::abs(point[2]), std::min(safx, safy));
+      safe[i] = inside[i] ? safmin : -safmin;
+   }
 }
@@ -131,6 +131,8 @@ shape:
 `Nlow=(Nx,Ny,Nz<0)`, `Nhigh=(Nx',Ny',Nz'>0)`.
 */
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 #include "TGeoManager.h"
@@ -1215,10 +1217,45 @@ void TGeoTube::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute distance from array of input points having directions specified by dirs. Store output in dists
-
-void TGeoTube::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
-{
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+/// Same result as DistFromInsideS for each point: all the candidate distances are computed and the result
+/// is selected without branches, so that the compiler can vectorize the loop.
+
+void TGeoTube::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* /*step*/) const
+{
+   const Double_t big = TGeoShape::Big();
+   const Double_t tol = TGeoShape::Tolerance();
+   const Bool_t hasRmin = fRmin>0;
+   const Double_t rmin2 = fRmin*fRmin;
+   const Double_t rmax2 = fRmax*fRmax;
+   for (Int_t i=0; i<vecsize; i++) {
+      const Double_t *point = &points[3*i];
+      const Double_t *dir = &dirs[3*i];
+      // Z planes
+      const Double_t sz = (dir[2]!=0) ? (std::copysign(fDz, dir[2])-point[2])/dir[2] : big;
+      const Bool_t zeroZ = (dir[2]!=0) && (sz<=0);
+      // R, see DistToTube
+      const Double_t nsq = dir[0]*dir[0]+dir[1]*dir[1];
+      const Bool_t parallel = std::abs(nsq)<tol;
+      const Double_t rsq = point[0]*point[0]+point[1]*point[1];
+      const Double_t rdotn = point[0]*dir[0]+point[1]*dir[1];
+      const Double_t t1 = 1./nsq;
+      const Double_t b = t1*rdotn;
+      const Double_t deltaMin = b*b-t1*(rsq-rmin2);
+      const Double_t deltaMax = b*b-t1*(rsq-rmax2);
+      const Double_t srMin = -b-std::sqrt(std::max(deltaMin, 0.));
+      const Double_t srMax = -b+std::sqrt(std::max(deltaMax, 0.));
+      const Bool_t onRmin = rsq <= rmin2+tol;
+      const Bool_t zeroRmin = hasRmin && onRmin && (rdotn<0);
+      const Bool_t hitRmin = hasRmin && !onRmin && (rdotn<0) && (deltaMin>0) && (srMin>0);
+      const Bool_t zeroRmax = (rsq >= rmax2-tol) && (rdotn>=0);
+      const Bool_t hitRmax = (deltaMax>0) && (srMax>0);
+      Double_t dist = hitRmax ? std::min(sz, srMax) : 0.;
+      dist = zeroRmax ? 0. : dist;
+      dist = hitRmin ? std::min(sz, srMin) : dist;
+      dist = zeroRmin ? 0. : dist;
+      dist = parallel ? sz : dist;
+      dists[i] = zeroZ ? 0. : dist;
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1233,10 +1270,19 @@ void TGeoTube::DistFromOutside_v(const Double_t *points, const Double_t *dirs, D
 /// Compute safe distance from each of the points in the input array.
 /// Input: Array of point coordinates, array of statuses for these points, size of the arrays
 /// Output: Safety values
+/// Same result as Safety for each point, written without branches so that the compiler can
+/// vectorize the loop.
 
 void TGeoTube::Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const
 {
-   for (Int_t i=0; i<vecsize; i++) safe[i] = Safety(&points[3*i], inside[i]);
+   const Bool_t hasRmin = fRmin>1E-10;
+   for (Int_t i=0; i<vecsize; i++) {
+      const Double_t *point = &points[3*i];
+      const Double_t r = std::sqrt(point[0]*point[0]+point[1]*point[1]);
+      Double_t safmin = std::min(fDz-std::abs(point[2]), fRmax-r);
+      safmin = hasRmin ? std::min(safmin, r-fRmin) : safmin;
+      safe[i] = inside[i] ? safmin : -safmin;
+   }
 }
 
 ClassImp(TGeoTubeSeg);
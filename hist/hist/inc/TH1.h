@@ -148,6 +148,9 @@ protected:
                                Option_t * opt, Bool_t doerr = kFALSE) const;
 
    virtual void     DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride=1);
+           Int_t    DoFillConcurrent(Double_t x, Double_t w);
+   virtual Bool_t   IsConcurrentFillSupported() const { return kFALSE; }
+   virtual void     AddBinContentAtomic(Int_t bin, Double_t w);
    Bool_t    GetStatOverflowsBehaviour() const { return EStatOverflows::kNeutral == fStatOverflows ? fgStatOverflows : EStatOverflows::kConsider == fStatOverflows; }
 
    static bool CheckAxisLimits(const TAxis* a1, const TAxis* a2);
@@ -162,6 +165,7 @@ public:
    enum EStatusBits {
       kNoStats     = BIT(9),   ///< Don't draw stats box
       kUserContour = BIT(10),  ///< User specified contour levels
+      kConcurrentFill = BIT(14), ///< Fill(x[, y[, z]][, w]) use atomic updates and can be called concurrently
       // kCanRebin    = BIT(11), ///< FIXME DEPRECATED - to be removed, replaced by SetCanExtend / CanExtendAllAxes
       kLogX        = BIT(15),  ///< X-axis in log scale
       kIsZoomed   = BIT(16),   ///< Bit set when zooming on Y axis
@@ -331,6 +335,7 @@ public:
            Bool_t   IsBinOverflow(Int_t bin, Int_t axis = 0) const;
            Bool_t   IsBinUnderflow(Int_t bin, Int_t axis = 0) const;
    virtual Bool_t   IsHighlight() const { return TestBit(kIsHighlight); }
+           Bool_t   IsConcurrentFill() const { return TestBit(kConcurrentFill); }
    virtual Double_t AndersonDarlingTest(const TH1 *h2, Option_t *option="") const;
    virtual Double_t AndersonDarlingTest(const TH1 *h2, Double_t &advalue) const;
    virtual Double_t KolmogorovTest(const TH1 *h2, Option_t *option="") const;
@@ -375,6 +380,7 @@ public:
    virtual void     SetBinErrorOption(EBinErrorOpt type) { fBinStatErrOpt = type; }
    virtual void     SetBuffer(Int_t buffersize, Option_t *option="");
    virtual UInt_t   SetCanExtend(UInt_t extendBitMask);
+           Bool_t   SetConcurrentFill(Bool_t on = kTRUE);
    virtual void     SetContent(const Double_t *content);
    virtual void     SetContour(Int_t nlevels, const Double_t *levels=0);
    virtual void     SetContourLevel(Int_t level, Double_t value);
@@ -602,6 +608,8 @@ public:
 protected:
    Double_t RetrieveBinContent(Int_t bin) const override { return Double_t (fArray[bin]); }
    void     UpdateBinContent(Int_t bin, Double_t content) override { fArray[bin] = Float_t (content); }
+   Bool_t   IsConcurrentFillSupported() const override { return kTRUE; }
+   void     AddBinContentAtomic(Int_t bin, Double_t w) override;
 };
 
 TH1F operator*(Double_t c1, const TH1F &h1);
@@ -645,6 +653,8 @@ public:
 protected:
    Double_t RetrieveBinContent(Int_t bin) const override { return fArray[bin]; }
    void     UpdateBinContent(Int_t bin, Double_t content) override { fArray[bin] = content; }
+   Bool_t   IsConcurrentFillSupported() const override { return kTRUE; }
+   void     AddBinContentAtomic(Int_t bin, Double_t w) override;
 };
 
 TH1D operator*(Double_t c1, const TH1D &h1);
@@ -48,6 +48,7 @@ protected:
                                          ,Int_t nbinsy,const Float_t  *ybins);
 
    virtual Int_t     BufferFill(Double_t x, Double_t y, Double_t w);
+           Int_t     DoFillConcurrent(Double_t x, Double_t y, Double_t w);
    virtual TH1D     *DoProjection(bool onX, const char *name, Int_t firstbin, Int_t lastbin, Option_t *option) const;
    virtual TProfile *DoProfile(bool onX, const char *name, Int_t firstbin, Int_t lastbin, Option_t *option) const;
    virtual TH1D     *DoQuantiles(bool onX, const char *name, Double_t prob) const;
@@ -290,6 +291,8 @@ public:
 protected:
            Double_t RetrieveBinContent(Int_t bin) const override { return Double_t (fArray[bin]); }
            void     UpdateBinContent(Int_t bin, Double_t content) override { fArray[bin] = Float_t (content); }
+           Bool_t   IsConcurrentFillSupported() const override { return kTRUE; }
+           void     AddBinContentAtomic(Int_t bin, Double_t w) override;
 
    ClassDefOverride(TH2F,4)  //2-Dim histograms (one float per channel)
 };
@@ -333,6 +336,8 @@ public:
 protected:
            Double_t RetrieveBinContent(Int_t bin) const override { return fArray[bin]; }
            void     UpdateBinContent(Int_t bin, Double_t content) override { fArray[bin] = content; }
+           Bool_t   IsConcurrentFillSupported() const override { return kTRUE; }
+           void     AddBinContentAtomic(Int_t bin, Double_t w) override;
 
    ClassDefOverride(TH2D,4)  //2-Dim histograms (one double per channel)
 };
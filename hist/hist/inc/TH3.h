@@ -50,6 +50,7 @@ protected:
                                          ,Int_t nbinsy,const Double_t *ybins
                                          ,Int_t nbinsz,const Double_t *zbins);
    virtual Int_t    BufferFill(Double_t x, Double_t y, Double_t z, Double_t w);
+           Int_t    DoFillConcurrent(Double_t x, Double_t y, Double_t z, Double_t w);
 
    void DoFillProfileProjection(TProfile2D * p2, const TAxis & a1, const TAxis & a2, const TAxis & a3, Int_t bin1, Int_t bin2, Int_t bin3, Int_t inBin, Bool_t useWeights) const;
 
@@ -87,6 +88,9 @@ public:
    virtual Int_t    Fill(const char *namex, Double_t y, Double_t z, Double_t w);
    virtual Int_t    Fill(Double_t x, const char *namey, Double_t z, Double_t w);
    virtual Int_t    Fill(Double_t x, Double_t y, const char *namez, Double_t w);
+           void     FillN(Int_t, const Double_t *, const Double_t *, Int_t) override {;} //MayNotUse
+           void     FillN(Int_t, const Double_t *, const Double_t *, const Double_t *, Int_t) override {;} //MayNotUse
+   virtual void     FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w, Int_t stride=1);
 
            void     FillRandom(const char *fname, Int_t ntimes=5000, TRandom *rng = nullptr) override;
            void     FillRandom(TH1 *h, Int_t ntimes=5000, TRandom *rng = nullptr) override;
@@ -303,6 +307,8 @@ public:
 protected:
            Double_t RetrieveBinContent(Int_t bin) const override { return Double_t (fArray[bin]); }
            void     UpdateBinContent(Int_t bin, Double_t content) override { fArray[bin] = Float_t (content); }
+           Bool_t   IsConcurrentFillSupported() const override { return kTRUE; }
+           void     AddBinContentAtomic(Int_t bin, Double_t w) override;
 
    ClassDefOverride(TH3F,4)  //3-Dim histograms (one float per channel)
 };
@@ -342,6 +348,8 @@ public:
 protected:
            Double_t RetrieveBinContent(Int_t bin) const override { return fArray[bin]; }
            void     UpdateBinContent(Int_t bin, Double_t content) override { fArray[bin] = content; }
+           Bool_t   IsConcurrentFillSupported() const override { return kTRUE; }
+           void     AddBinContentAtomic(Int_t bin, Double_t w) override;
 
    ClassDefOverride(TH3D,4)  //3-Dim histograms (one double per channel)
 };
@@ -54,6 +54,7 @@ protected:
    void SetBins(const Int_t* nbins, const Double_t* range) { SetBins(nbins[0], range[0], range[1]); };
    Int_t Fill(const Double_t* v) { return Fill(v[0], v[1], v[2]); };
 
+   Bool_t   IsConcurrentFillSupported() const override { return kFALSE; }
    Double_t RetrieveBinContent(Int_t bin) const override { return (fBinEntries.fArray[bin] > 0) ? fArray[bin]/fBinEntries.fArray[bin] : 0; }
    //virtual void     UpdateBinContent(Int_t bin, Double_t content);
    Double_t GetBinErrorSqUnchecked(Int_t bin) const override { Double_t err = GetBinError(bin); return err*err; }
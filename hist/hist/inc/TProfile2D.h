@@ -55,6 +55,7 @@ protected:
    using TH2::Fill;
    Int_t             Fill(Double_t, Double_t) override {return TH2::Fill(0); } //MayNotUse
 
+   Bool_t   IsConcurrentFillSupported() const override { return kFALSE; }
    Double_t RetrieveBinContent(Int_t bin) const override { return (fBinEntries.fArray[bin] > 0) ? fArray[bin]/fBinEntries.fArray[bin] : 0; }
    //virtual void     UpdateBinContent(Int_t bin, Double_t content);
    Double_t GetBinErrorSqUnchecked(Int_t bin) const override { Double_t err = GetBinError(bin); return err*err; }
@@ -52,6 +52,7 @@
 #include "Math/QuantFuncMathCore.h"
 
 #include "TH1Merger.h"
+#include "TH1AtomicHelper.h"
 
 /** \addtogroup Histograms
 @{
@@ -1262,6 +1263,17 @@ void TH1::AddBinContent(Int_t, Double_t)
    AbstractMethod("AddBinContent");
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Increment bin content by a weight w in a way that is safe against concurrent
+/// updates. Used by the concurrent fill mode (see TH1::SetConcurrentFill);
+/// the default implementation is not thread-safe and only classes for which
+/// IsConcurrentFillSupported() returns true override it.
+
+void TH1::AddBinContentAtomic(Int_t bin, Double_t w)
+{
+   AddBinContent(bin, w);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Sets the flag controlling the automatic add of histograms in memory
 ///
@@ -3349,6 +3361,7 @@ TH1* TH1::FFT(TH1* h_output, Option_t *option)
 
 Int_t TH1::Fill(Double_t x)
 {
+   if (TestBit(kConcurrentFill)) return DoFillConcurrent(x, 1.);
    if (fBuffer)  return BufferFill(x,1);
 
    Int_t bin;
@@ -3382,6 +3395,7 @@ Int_t TH1::Fill(Double_t x)
 Int_t TH1::Fill(Double_t x, Double_t w)
 {
 
+   if (TestBit(kConcurrentFill)) return DoFillConcurrent(x, w);
    if (fBuffer) return BufferFill(x,w);
 
    Int_t bin;
@@ -3402,6 +3416,27 @@ Int_t TH1::Fill(Double_t x, Double_t w)
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Implementation of Fill(x[, w]) when the concurrent fill mode is active.
+/// Bin contents and statistics are updated with atomic operations.
+/// See TH1::SetConcurrentFill.
+
+Int_t TH1::DoFillConcurrent(Double_t x, Double_t w)
+{
+   ROOT::Internal::AtomicAdd(fEntries, 1.);
+   Int_t bin = fXaxis.FindFixBin(x);
+   if (fSumw2.fN) ROOT::Internal::AtomicAdd(fSumw2.fArray[bin], w*w);
+   AddBinContentAtomic(bin, w);
+   if (bin == 0 || bin > fXaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour()) return -1;
+   }
+   ROOT::Internal::AtomicAdd(fTsumw, w);
+   ROOT::Internal::AtomicAdd(fTsumw2, w*w);
+   ROOT::Internal::AtomicAdd(fTsumwx, w*x);
+   ROOT::Internal::AtomicAdd(fTsumwx2, w*x*x);
+   return bin;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment bin with namex with a weight w
 ///
@@ -3449,6 +3484,9 @@ Int_t TH1::Fill(const char *namex, Double_t w)
 /// weights is automatically triggered and the sum of the squares of weights is incremented
 /// by \f$ w^2 \f$ in the bin corresponding to x.
 /// if w is NULL each entry is assumed a weight=1
+///
+/// If the axis cannot be extended, the bin numbers are computed in chunks of entries
+/// with TAxis::FindFixBins, which is faster than calling Fill for each entry.
 
 void TH1::FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
 {
@@ -3478,27 +3516,34 @@ void TH1::FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride
 
 void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
 {
-   Int_t bin,i;
-
    fEntries += ntimes;
    Double_t ww = 1;
    Int_t nbins   = fXaxis.GetNbins();
-   ntimes *= stride;
-   for (i=0;i<ntimes;i+=stride) {
-      bin =fXaxis.FindBin(x[i]);
-      if (bin <0) continue;
-      if (w) ww = w[i];
-      if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
-      if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
-      AddBinContent(bin, ww);
-      if (bin == 0 || bin > nbins) {
-         if (!GetStatOverflowsBehaviour()) continue;
+   // If the axis cannot be extended, bin numbers do not change during the fill and
+   // they are computed in chunks with TAxis::FindFixBins before updating the contents.
+   const Bool_t findBinsInChunks = !fXaxis.CanExtend();
+   constexpr Int_t kChunkSize = 256;
+   Int_t bins[kChunkSize];
+   for (Int_t first = 0; first < ntimes; first += kChunkSize) {
+      const Int_t n = std::min(kChunkSize, ntimes - first);
+      if (findBinsInChunks) fXaxis.FindFixBins(n, &x[first*stride], bins, stride);
+      for (Int_t j = 0; j < n; ++j) {
+         const Int_t i = (first + j)*stride;
+         const Int_t bin = findBinsInChunks ? bins[j] : fXaxis.FindBin(x[i]);
+         if (bin <0) continue;
+         if (w) ww = w[i];
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+         if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+         AddBinContent(bin, ww);
+         if (bin == 0 || bin > nbins) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         Double_t z= ww;
+         fTsumw   += z;
+         fTsumw2  += z*z;
+         fTsumwx  += z*x[i];
+         fTsumwx2 += z*x[i]*x[i];
       }
-      Double_t z= ww;
-      fTsumw   += z;
-      fTsumw2  += z*z;
-      fTsumwx  += z*x[i];
-      fTsumwx2 += z*x[i]*x[i];
    }
 }
 
@@ -6657,6 +6702,47 @@ UInt_t TH1::SetCanExtend(UInt_t extendBitMask)
    return oldExtendBitMask;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the concurrent fill mode.
+///
+/// When the mode is on, Fill(x[, y[, z]][, w]) can be called concurrently from
+/// several threads on the same histogram: bin contents, sums of squares of weights
+/// and statistics are updated with atomic operations. This avoids one copy of the
+/// histogram per thread and the final merge, at the price of contention on the
+/// statistics when many threads fill at a high rate.
+///
+/// Restrictions while the mode is on:
+///  - only the numeric Fill overloads are thread-safe (not the ones taking bin labels,
+///    nor FillN, SetBinContent, etc.);
+///  - the axes are never extended, entries outside the axis range go to the under/overflow bins;
+///  - the storage of the sum of squares of weights is not triggered automatically by
+///    weights different from 1: call Sumw2() before enabling the mode if needed;
+///  - the histogram buffer is emptied and no longer used.
+///
+/// The mode is supported by TH1F, TH1D, TH2F, TH2D, TH3F and TH3D. The function returns
+/// kFALSE, leaving the mode off, for other classes.
+///
+/// The mode is not stored in files: histograms read back from a file have it off.
+
+Bool_t TH1::SetConcurrentFill(Bool_t on)
+{
+   if (!on) {
+      ResetBit(kConcurrentFill);
+      return kTRUE;
+   }
+   if (!IsConcurrentFillSupported()) {
+      Error("SetConcurrentFill", "concurrent fill mode is not supported by %s", IsA()->GetName());
+      return kFALSE;
+   }
+   if (fBuffer) BufferEmpty(1);
+   if (fXaxis.CanExtend() || (GetDimension() > 1 && fYaxis.CanExtend()) ||
+       (GetDimension() > 2 && fZaxis.CanExtend())) {
+      Warning("SetConcurrentFill", "axes of %s will not be extended while in concurrent fill mode", GetName());
+   }
+   SetBit(kConcurrentFill);
+   return kTRUE;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Internal function used in TH1::Fill to see which axis is full alphanumeric
 /// i.e. can be extended and is alphanumeric
@@ -6935,6 +7021,8 @@ void TH1::Streamer(TBuffer &b)
          b.ReadClassBuffer(TH1::Class(), this, R__v, R__s, R__c);
 
          ResetBit(kMustCleanup);
+         // fBits is streamed, but the concurrent fill mode is a property of the in-memory object
+         ResetBit(kConcurrentFill);
          fXaxis.SetParent(this);
          fYaxis.SetParent(this);
          fZaxis.SetParent(this);
@@ -9986,6 +10074,14 @@ void TH1F::Reset(Option_t *option)
    TArrayF::Reset();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Atomically increment bin content by w (see TH1::SetConcurrentFill).
+
+void TH1F::AddBinContentAtomic(Int_t bin, Double_t w)
+{
+   ROOT::Internal::AtomicAdd(fArray[bin], Float_t(w));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set total number of bins including under/overflow
 /// Reallocate bin contents array
@@ -10165,6 +10261,14 @@ void TH1D::Reset(Option_t *option)
    TArrayD::Reset();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Atomically increment bin content by w (see TH1::SetConcurrentFill).
+
+void TH1D::AddBinContentAtomic(Int_t bin, Double_t w)
+{
+   ROOT::Internal::AtomicAdd(fArray[bin], Double_t(w));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set total number of bins including under/overflow
 /// Reallocate bin contents array
@@ -0,0 +1,63 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Helper functions for the concurrent fill mode of the histograms (see TH1::SetConcurrentFill)
+
+#ifndef ROOT_TH1AtomicHelper
+#define ROOT_TH1AtomicHelper
+
+#include <atomic>
+#include <cstdint>
+#include <functional> // std::hash
+#include <mutex>
+
+namespace ROOT {
+namespace Internal {
+
+/// Mutexes protecting the updates of AtomicAdd for the platforms that do not support atomic operations on plain
+/// variables. A variable is always protected by the same mutex, selected by its address.
+inline std::mutex &GetAtomicAddMutex(const void *address)
+{
+   static std::mutex mutexes[64];
+   return mutexes[std::hash<const void *>{}(address) % 64];
+}
+
+/// Atomically add value to target, a plain floating point variable that other threads might update concurrently
+/// through this function.
+template <typename T>
+inline void AtomicAdd(T &target, T value)
+{
+#if defined(__cpp_lib_atomic_ref)
+   if (reinterpret_cast<std::uintptr_t>(&target) % std::atomic_ref<T>::required_alignment == 0) {
+      std::atomic_ref<T> atomicTarget(target);
+      T expected = atomicTarget.load(std::memory_order_relaxed);
+      while (!atomicTarget.compare_exchange_weak(expected, expected + value, std::memory_order_relaxed)) {
+      }
+      return;
+   }
+#elif defined(__GNUC__)
+   // the GCC/clang atomic builtins operate on plain (non std::atomic) objects
+   T expected;
+   __atomic_load(&target, &expected, __ATOMIC_RELAXED);
+   T desired = expected + value;
+   while (!__atomic_compare_exchange(&target, &expected, &desired, /*weak=*/true, __ATOMIC_RELAXED,
+                                     __ATOMIC_RELAXED)) {
+      desired = expected + value;
+   }
+   return;
+#endif
+   std::lock_guard<std::mutex> lock(GetAtomicAddMutex(&target));
+   target += value;
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -27,6 +27,7 @@
 #include "TObjArray.h"
 #include "TVirtualHistPainter.h"
 #include "snprintf.h"
+#include "TH1AtomicHelper.h"
 
 ClassImp(TH2);
 
@@ -379,6 +380,7 @@ Int_t TH2::Fill(Double_t )
 
 Int_t TH2::Fill(Double_t x,Double_t y)
 {
+   if (TestBit(kConcurrentFill)) return DoFillConcurrent(x, y, 1.);
    if (fBuffer) return BufferFill(x,y,1);
 
    Int_t binx, biny, bin;
@@ -423,6 +425,7 @@ Int_t TH2::Fill(Double_t x,Double_t y)
 
 Int_t TH2::Fill(Double_t x, Double_t y, Double_t w)
 {
+   if (TestBit(kConcurrentFill)) return DoFillConcurrent(x, y, w);
    if (fBuffer) return BufferFill(x,y,w);
 
    Int_t binx, biny, bin;
@@ -451,6 +454,34 @@ Int_t TH2::Fill(Double_t x, Double_t y, Double_t w)
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Implementation of Fill(x, y[, w]) when the concurrent fill mode is active.
+/// See TH1::SetConcurrentFill.
+
+Int_t TH2::DoFillConcurrent(Double_t x, Double_t y, Double_t w)
+{
+   ROOT::Internal::AtomicAdd(fEntries, 1.);
+   Int_t binx = fXaxis.FindFixBin(x);
+   Int_t biny = fYaxis.FindFixBin(y);
+   Int_t bin  = biny*(fXaxis.GetNbins()+2) + binx;
+   if (fSumw2.fN) ROOT::Internal::AtomicAdd(fSumw2.fArray[bin], w*w);
+   AddBinContentAtomic(bin, w);
+   if (binx == 0 || binx > fXaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour()) return -1;
+   }
+   if (biny == 0 || biny > fYaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour()) return -1;
+   }
+   ROOT::Internal::AtomicAdd(fTsumw, w);
+   ROOT::Internal::AtomicAdd(fTsumw2, w*w);
+   ROOT::Internal::AtomicAdd(fTsumwx, w*x);
+   ROOT::Internal::AtomicAdd(fTsumwx2, w*x*x);
+   ROOT::Internal::AtomicAdd(fTsumwy, w*y);
+   ROOT::Internal::AtomicAdd(fTsumwy2, w*y*y);
+   ROOT::Internal::AtomicAdd(fTsumwxy, w*x*y);
+   return bin;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment cell defined by namex,namey by a weight w
@@ -604,6 +635,9 @@ Int_t TH2::Fill(Double_t x, const char *namey, Double_t w)
 ///     by w[i]^2 in the bin corresponding to x[i],y[i].
 ///   - If w is NULL each entry is assumed a weight=1
 ///
+/// If the axes cannot be extended, the bin numbers are computed in chunks of entries
+/// with TAxis::FindFixBins, which is faster than calling Fill for each entry.
+///
 /// NB: function only valid for a TH2x object
 
 void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride)
@@ -627,31 +661,44 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
          return;
    }
 
+   // If the axes cannot be extended, bin numbers do not change during the fill and
+   // they are computed in chunks with TAxis::FindFixBins before updating the contents.
+   const Bool_t findBinsInChunks = !fXaxis.CanExtend() && !fYaxis.CanExtend();
+   constexpr Int_t kChunkSize = 256;
+   Int_t binsx[kChunkSize], binsy[kChunkSize];
    Double_t ww = 1;
-   for (i=ifirst;i<ntimes;i+=stride) {
-      fEntries++;
-      binx = fXaxis.FindBin(x[i]);
-      biny = fYaxis.FindBin(y[i]);
-      if (binx <0 || biny <0) continue;
-      bin  = biny*(fXaxis.GetNbins()+2) + binx;
-      if (w) ww = w[i];
-      if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
-      if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
-      AddBinContent(bin,ww);
-      if (binx == 0 || binx > fXaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+   for (Int_t first = ifirst; first < ntimes; first += kChunkSize*stride) {
+      const Int_t n = std::min(kChunkSize, (ntimes - first + stride - 1)/stride);
+      if (findBinsInChunks) {
+         fXaxis.FindFixBins(n, &x[first], binsx, stride);
+         fYaxis.FindFixBins(n, &y[first], binsy, stride);
       }
-      if (biny == 0 || biny > fYaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+      for (Int_t j = 0; j < n; ++j) {
+         i = first + j*stride;
+         fEntries++;
+         binx = findBinsInChunks ? binsx[j] : fXaxis.FindBin(x[i]);
+         biny = findBinsInChunks ? binsy[j] : fYaxis.FindBin(y[i]);
+         if (binx <0 || biny <0) continue;
+         bin  = biny*(fXaxis.GetNbins()+2) + binx;
+         if (w) ww = w[i];
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+         if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+         AddBinContent(bin,ww);
+         if (binx == 0 || binx > fXaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         if (biny == 0 || biny > fYaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         Double_t z= ww; //(ww > 0 ? ww : -ww);
+         fTsumw   += z;
+         fTsumw2  += z*z;
+         fTsumwx  += z*x[i];
+         fTsumwx2 += z*x[i]*x[i];
+         fTsumwy  += z*y[i];
+         fTsumwy2 += z*y[i]*y[i];
+         fTsumwxy += z*x[i]*y[i];
       }
-      Double_t z= ww; //(ww > 0 ? ww : -ww);
-      fTsumw   += z;
-      fTsumw2  += z*z;
-      fTsumwx  += z*x[i];
-      fTsumwx2 += z*x[i]*x[i];
-      fTsumwy  += z*y[i];
-      fTsumwy2 += z*y[i]*y[i];
-      fTsumwxy += z*x[i]*y[i];
    }
 }
 
@@ -3671,6 +3718,14 @@ void TH2F::Reset(Option_t *option)
    TArrayF::Reset();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Atomically increment bin content by w (see TH1::SetConcurrentFill).
+
+void TH2F::AddBinContentAtomic(Int_t bin, Double_t w)
+{
+   ROOT::Internal::AtomicAdd(fArray[bin], Float_t(w));
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Set total number of bins including under/overflow
@@ -3943,6 +3998,14 @@ void TH2D::Reset(Option_t *option)
    TArrayD::Reset();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Atomically increment bin content by w (see TH1::SetConcurrentFill).
+
+void TH2D::AddBinContentAtomic(Int_t bin, Double_t w)
+{
+   ROOT::Internal::AtomicAdd(fArray[bin], Double_t(w));
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Set total number of bins including under/overflow
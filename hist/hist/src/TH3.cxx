@@ -24,6 +24,7 @@
 #include "TError.h"
 #include "TMath.h"
 #include "TObjString.h"
+#include "TH1AtomicHelper.h"
 
 ClassImp(TH3);
 
@@ -349,6 +350,7 @@ Int_t TH3::Fill(Double_t )
 
 Int_t TH3::Fill(Double_t x, Double_t y, Double_t z)
 {
+   if (TestBit(kConcurrentFill)) return DoFillConcurrent(x, y, z, 1.);
    if (fBuffer) return BufferFill(x,y,z,1);
 
    Int_t binx, biny, binz, bin;
@@ -397,6 +399,7 @@ Int_t TH3::Fill(Double_t x, Double_t y, Double_t z)
 
 Int_t TH3::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
 {
+   if (TestBit(kConcurrentFill)) return DoFillConcurrent(x, y, z, w);
    if (fBuffer) return BufferFill(x,y,z,w);
 
    Int_t binx, biny, binz, bin;
@@ -432,6 +435,126 @@ Int_t TH3::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Implementation of Fill(x, y, z[, w]) when the concurrent fill mode is active.
+/// See TH1::SetConcurrentFill.
+
+Int_t TH3::DoFillConcurrent(Double_t x, Double_t y, Double_t z, Double_t w)
+{
+   ROOT::Internal::AtomicAdd(fEntries, 1.);
+   Int_t binx = fXaxis.FindFixBin(x);
+   Int_t biny = fYaxis.FindFixBin(y);
+   Int_t binz = fZaxis.FindFixBin(z);
+   Int_t bin  =  binx + (fXaxis.GetNbins()+2)*(biny + (fYaxis.GetNbins()+2)*binz);
+   if (fSumw2.fN) ROOT::Internal::AtomicAdd(fSumw2.fArray[bin], w*w);
+   AddBinContentAtomic(bin, w);
+   if (binx == 0 || binx > fXaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour()) return -1;
+   }
+   if (biny == 0 || biny > fYaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour()) return -1;
+   }
+   if (binz == 0 || binz > fZaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour()) return -1;
+   }
+   ROOT::Internal::AtomicAdd(fTsumw, w);
+   ROOT::Internal::AtomicAdd(fTsumw2, w*w);
+   ROOT::Internal::AtomicAdd(fTsumwx, w*x);
+   ROOT::Internal::AtomicAdd(fTsumwx2, w*x*x);
+   ROOT::Internal::AtomicAdd(fTsumwy, w*y);
+   ROOT::Internal::AtomicAdd(fTsumwy2, w*y*y);
+   ROOT::Internal::AtomicAdd(fTsumwxy, w*x*y);
+   ROOT::Internal::AtomicAdd(fTsumwz, w*z);
+   ROOT::Internal::AtomicAdd(fTsumwz2, w*z*z);
+   ROOT::Internal::AtomicAdd(fTsumwxz, w*x*z);
+   ROOT::Internal::AtomicAdd(fTsumwyz, w*y*z);
+   return bin;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill a 3-D histogram with an array of values and weights.
+///
+///  - ntimes:  number of entries in arrays x, y, z and w (array size must be ntimes*stride)
+///  - x:       array of x values to be histogrammed
+///  - y:       array of y values to be histogrammed
+///  - z:       array of z values to be histogrammed
+///  - w:       array of weights (can be a null pointer, in which case all weights are 1)
+///  - stride:  step size through arrays x, y, z and w
+///
+/// If the weight is not equal to 1, the storage of the sum of squares of
+/// weights is automatically triggered and the sum of the squares of weights is incremented
+/// by w[i]^2 in the cell corresponding to x[i], y[i], z[i].
+///
+/// If none of the axes can be extended, the bin numbers are computed in chunks of
+/// entries with TAxis::FindFixBins, which is faster than calling Fill for each entry.
+
+void TH3::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w, Int_t stride)
+{
+   Int_t binx, biny, binz, bin, i;
+   ntimes *= stride;
+   Int_t ifirst = 0;
+
+   //If a buffer is activated, fill buffer
+   // (note that this function must not be called from TH3::BufferEmpty)
+   if (fBuffer) {
+      for (i=0;i<ntimes;i+=stride) {
+         if (!fBuffer) break; // buffer can be deleted in BufferFill when is empty
+         BufferFill(x[i], y[i], z[i], w ? w[i] : 1.);
+      }
+      // fill the remaining entries if the buffer has been deleted
+      if (i < ntimes && !fBuffer)
+         ifirst = i;
+      else
+         return;
+   }
+
+   const Bool_t findBinsInChunks = !fXaxis.CanExtend() && !fYaxis.CanExtend() && !fZaxis.CanExtend();
+   constexpr Int_t kChunkSize = 256;
+   Int_t binsx[kChunkSize], binsy[kChunkSize], binsz[kChunkSize];
+   Double_t ww = 1;
+   for (Int_t first = ifirst; first < ntimes; first += kChunkSize*stride) {
+      const Int_t n = std::min(kChunkSize, (ntimes - first + stride - 1)/stride);
+      if (findBinsInChunks) {
+         fXaxis.FindFixBins(n, &x[first], binsx, stride);
+         fYaxis.FindFixBins(n, &y[first], binsy, stride);
+         fZaxis.FindFixBins(n, &z[first], binsz, stride);
+      }
+      for (Int_t j = 0; j < n; ++j) {
+         i = first + j*stride;
+         fEntries++;
+         binx = findBinsInChunks ? binsx[j] : fXaxis.FindBin(x[i]);
+         biny = findBinsInChunks ? binsy[j] : fYaxis.FindBin(y[i]);
+         binz = findBinsInChunks ? binsz[j] : fZaxis.FindBin(z[i]);
+         if (binx <0 || biny <0 || binz<0) continue;
+         bin  =  binx + (fXaxis.GetNbins()+2)*(biny + (fYaxis.GetNbins()+2)*binz);
+         if (w) ww = w[i];
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+         if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+         AddBinContent(bin,ww);
+         if (binx == 0 || binx > fXaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         if (biny == 0 || biny > fYaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         if (binz == 0 || binz > fZaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         fTsumw   += ww;
+         fTsumw2  += ww*ww;
+         fTsumwx  += ww*x[i];
+         fTsumwx2 += ww*x[i]*x[i];
+         fTsumwy  += ww*y[i];
+         fTsumwy2 += ww*y[i]*y[i];
+         fTsumwxy += ww*x[i]*y[i];
+         fTsumwz  += ww*z[i];
+         fTsumwz2 += ww*z[i]*z[i];
+         fTsumwxz += ww*x[i]*z[i];
+         fTsumwyz += ww*y[i]*z[i];
+      }
+   }
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment cell defined by namex,namey,namez by a weight w
@@ -4222,6 +4345,14 @@ void TH3F::Reset(Option_t *option)
    // should also reset statistics once statistics are implemented for TH3
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Atomically increment bin content by w (see TH1::SetConcurrentFill).
+
+void TH3F::AddBinContentAtomic(Int_t bin, Double_t w)
+{
+   ROOT::Internal::AtomicAdd(fArray[bin], Float_t(w));
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Set total number of bins including under/overflow
@@ -4437,6 +4568,14 @@ void TH3D::Reset(Option_t *option)
    // should also reset statistics once statistics are implemented for TH3
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Atomically increment bin content by w (see TH1::SetConcurrentFill).
+
+void TH3D::AddBinContentAtomic(Int_t bin, Double_t w)
+{
+   ROOT::Internal::AtomicAdd(fArray[bin], Double_t(w));
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Set total number of bins including under/overflow
@@ -789,28 +789,38 @@ void TProfile::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const D
          return;
    }
 
-   for (i=ifirst;i<ntimes;i+=stride) {
-      if (fYmin != fYmax) {
-         if (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i])) continue;
-      }
+   // If the axis cannot be extended, bin numbers do not change during the fill and
+   // they are computed in chunks with TAxis::FindFixBins before updating the contents.
+   const Bool_t findBinsInChunks = !fXaxis.CanExtend();
+   constexpr Int_t kChunkSize = 256;
+   Int_t bins[kChunkSize];
+   for (Int_t first = ifirst; first < ntimes; first += kChunkSize*stride) {
+      const Int_t n = std::min(kChunkSize, (ntimes - first + stride - 1)/stride);
+      if (findBinsInChunks) fXaxis.FindFixBins(n, &x[first], bins, stride);
+      for (Int_t j = 0; j < n; ++j) {
+         i = first + j*stride;
+         if (fYmin != fYmax) {
+            if (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i])) continue;
+         }
 
-      Double_t u = (w) ? w[i] : 1; // (w[i] > 0 ? w[i] : -w[i]);
-      fEntries++;
-      bin =fXaxis.FindBin(x[i]);
-      AddBinContent(bin, u*y[i]);
-      fSumw2.fArray[bin] += u*y[i]*y[i];
-      if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();  // must be called before accumulating the entries
-      if (fBinSumw2.fN)  fBinSumw2.fArray[bin] += u*u;
-      fBinEntries.fArray[bin] += u;
-      if (bin == 0 || bin > fXaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+         Double_t u = (w) ? w[i] : 1; // (w[i] > 0 ? w[i] : -w[i]);
+         fEntries++;
+         bin = findBinsInChunks ? bins[j] : fXaxis.FindBin(x[i]);
+         AddBinContent(bin, u*y[i]);
+         fSumw2.fArray[bin] += u*y[i]*y[i];
+         if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();  // must be called before accumulating the entries
+         if (fBinSumw2.fN)  fBinSumw2.fArray[bin] += u*u;
+         fBinEntries.fArray[bin] += u;
+         if (bin == 0 || bin > fXaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         fTsumw   += u;
+         fTsumw2  += u*u;
+         fTsumwx  += u*x[i];
+         fTsumwx2 += u*x[i]*x[i];
+         fTsumwy  += u*y[i];
+         fTsumwy2 += u*y[i]*y[i];
       }
-      fTsumw   += u;
-      fTsumw2  += u*u;
-      fTsumwx  += u*x[i];
-      fTsumwx2 += u*x[i]*x[i];
-      fTsumwy  += u*y[i];
-      fTsumwy2 += u*y[i]*y[i];
    }
 }
 
@@ -1,9 +1,20 @@
 #include "gtest/gtest.h"
 
+#include "TBufferFile.h"
 #include "TH1.h"
 #include "TH1F.h"
+#include "TH2D.h"
+#include "TH3D.h"
+#include "TH3F.h"
+#include "TProfile.h"
 #include "THLimitsFinder.h"
 
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
 // StatOverflows TH1
 TEST(TH1, StatOverflows)
 {
@@ -46,3 +57,140 @@ TEST(THLimitsFinder, Degenerate)
    EXPECT_LE(xmin, centralValue - 5.);
    EXPECT_GE(xmax, centralValue + 5.);
 }
+
+// Concurrent fill mode: filling from several threads must give the same result as a sequential fill
+TEST(TH1, ConcurrentFill)
+{
+   const int nThreads = 4;
+   const int nFills = 20000;
+   // values and weights are chosen such that all sums are exact, independently of the order of the additions
+   auto value = [](int i) { return (i % 24) * 0.5 - 1.; };
+   auto weight = [](int i) { return 1. + (i % 3); };
+
+   TH2D h2seq("h2seq", "", 10, 0, 10, 5, 0, 5);
+   TH3F h3seq("h3seq", "", 10, 0, 10, 5, 0, 5, 4, 0, 4);
+   TH2D h2("h2", "", 10, 0, 10, 5, 0, 5);
+   TH3F h3("h3", "", 10, 0, 10, 5, 0, 5, 4, 0, 4);
+   h2seq.Sumw2();
+   h2.Sumw2();
+   EXPECT_TRUE(h2.SetConcurrentFill());
+   EXPECT_TRUE(h3.SetConcurrentFill());
+   EXPECT_TRUE(h3.IsConcurrentFill());
+
+   for (int t = 0; t < nThreads; ++t) {
+      for (int i = 0; i < nFills; ++i) {
+         h2seq.Fill(value(i), value(i + t), weight(i));
+         h3seq.Fill(value(i), value(i + t), value(i + 2 * t));
+      }
+   }
+
+   std::vector<std::thread> threads;
+   for (int t = 0; t < nThreads; ++t) {
+      threads.emplace_back([&, t]() {
+         for (int i = 0; i < nFills; ++i) {
+            h2.Fill(value(i), value(i + t), weight(i));
+            h3.Fill(value(i), value(i + t), value(i + 2 * t));
+         }
+      });
+   }
+   for (auto &th : threads)
+      th.join();
+
+   EXPECT_EQ(h2seq.GetEntries(), h2.GetEntries());
+   EXPECT_EQ(h3seq.GetEntries(), h3.GetEntries());
+   for (int bin = 0; bin < h2.GetNcells(); ++bin) {
+      EXPECT_EQ(h2seq.GetBinContent(bin), h2.GetBinContent(bin));
+      EXPECT_EQ(h2seq.GetBinError(bin), h2.GetBinError(bin));
+   }
+   for (int bin = 0; bin < h3.GetNcells(); ++bin)
+      EXPECT_EQ(h3seq.GetBinContent(bin), h3.GetBinContent(bin));
+
+   Double_t statsSeq[TH1::kNstat], stats[TH1::kNstat];
+   h2seq.GetStats(statsSeq);
+   h2.GetStats(stats);
+   for (int i = 0; i < 7; ++i)
+      EXPECT_EQ(statsSeq[i], stats[i]);
+   h3seq.GetStats(statsSeq);
+   h3.GetStats(stats);
+   for (int i = 0; i < 11; ++i)
+      EXPECT_EQ(statsSeq[i], stats[i]);
+
+   // switching the mode off restores the standard fill
+   h2.SetConcurrentFill(false);
+   EXPECT_FALSE(h2.IsConcurrentFill());
+
+   TProfile prof("prof", "", 10, 0, 10);
+   EXPECT_FALSE(prof.SetConcurrentFill());
+   EXPECT_FALSE(prof.IsConcurrentFill());
+}
+
+// The concurrent fill mode is not persistified
+TEST(TH1, ConcurrentFillNotStreamed)
+{
+   TH2D h("h", "", 10, 0, 10, 10, 0, 10);
+   ASSERT_TRUE(h.SetConcurrentFill());
+   h.Fill(1., 2.);
+
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteObject(&h);
+   buf.SetReadMode();
+   buf.SetBufferOffset(0);
+   std::unique_ptr<TH2D> hRead(static_cast<TH2D *>(buf.ReadObject(TH2D::Class())));
+   ASSERT_NE(hRead, nullptr);
+   EXPECT_FALSE(hRead->IsConcurrentFill());
+   EXPECT_EQ(hRead->GetBinContent(2, 3), 1.);
+   EXPECT_TRUE(h.IsConcurrentFill());
+}
+
+// FillN computes the bin numbers in chunks: it must give the same result as Fill for each entry
+TEST(TH1, FillNSameAsFill)
+{
+   const int n = 1000; // more than one chunk
+   const int stride = 2;
+   std::vector<double> x(n * stride), y(n * stride), z(n * stride), w(n * stride);
+   for (int i = 0; i < n * stride; ++i) {
+      x[i] = -1.3 + 0.0137 * i;
+      y[i] = std::sin(i) * 6;
+      z[i] = std::cos(i) * 3;
+      w[i] = 0.5 + (i % 5);
+   }
+   x[10] = std::numeric_limits<double>::quiet_NaN();
+   x[20] = 10.; // upper edge of the axis
+
+   TH1D h1("h1", "", 20, 0, 10);
+   TH1D h1n("h1n", "", 20, 0, 10);
+   double edges[] = {-5, -1, 0, 0.5, 2, 5};
+   TH2F h2("h2", "", 5, edges, 8, -4, 4);
+   TH2F h2n("h2n", "", 5, edges, 8, -4, 4);
+   TH3D h3("h3", "", 10, 0, 10, 6, -3, 3, 4, -2, 2);
+   TH3D h3n("h3n", "", 10, 0, 10, 6, -3, 3, 4, -2, 2);
+   TProfile p("p", "", 20, 0, 10);
+   TProfile pn("pn", "", 20, 0, 10);
+   for (int i = 0; i < n * stride; i += stride) {
+      h1.Fill(x[i], w[i]);
+      h2.Fill(y[i], z[i], w[i]);
+      h3.Fill(x[i], y[i], z[i], w[i]);
+      p.Fill(x[i], y[i], w[i]);
+   }
+   h1n.FillN(n, x.data(), w.data(), stride);
+   h2n.FillN(n, y.data(), z.data(), w.data(), stride);
+   h3n.FillN(n, x.data(), y.data(), z.data(), w.data(), stride);
+   pn.FillN(n, x.data(), y.data(), w.data(), stride);
+
+   auto checkSame = [](const TH1 &h, const TH1 &hn) {
+      EXPECT_EQ(h.GetEntries(), hn.GetEntries());
+      for (int bin = 0; bin < h.GetNcells(); ++bin) {
+         EXPECT_EQ(h.GetBinContent(bin), hn.GetBinContent(bin)) << h.GetName() << " bin " << bin;
+         EXPECT_EQ(h.GetBinError(bin), hn.GetBinError(bin)) << h.GetName() << " bin " << bin;
+      }
+      Double_t stats[TH1::kNstat] = {}, statsn[TH1::kNstat] = {};
+      h.GetStats(stats);
+      hn.GetStats(statsn);
+      for (int i = 0; i < TH1::kNstat; ++i)
+         EXPECT_DOUBLE_EQ(stats[i], statsn[i]) << h.GetName() << " stat " << i;
+   };
+   checkSame(h1, h1n);
+   checkSame(h2, h2n);
+   checkSame(h3, h3n);
+   checkSame(p, pn);
+}
@@ -9,13 +9,17 @@
 #ifndef ROOT_RIoUring
 #define ROOT_RIoUring
 
+#include <algorithm>
+#include <cerrno>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <liburing.h>
 #include <liburing/io_uring.h>
+#include <unistd.h>
 
 #include "TError.h"
 
@@ -94,20 +98,64 @@ public:
       int fFileDes = -1;
    };
 
+private:
+   /// Maximum number of times a read event is resubmitted after -EINTR or -EAGAIN before it is completed with pread()
+   static constexpr unsigned int kMaxRetries = 8;
+
+   /// Blocking read of the remaining bytes of a read event that could not be completed through the ring
+   static void CompleteWithPread(RReadEvent &ev)
+   {
+      while (ev.fOutBytes < ev.fSize) {
+         const auto res = pread(ev.fFileDes, static_cast<unsigned char *>(ev.fBuffer) + ev.fOutBytes,
+                                ev.fSize - ev.fOutBytes, ev.fOffset + ev.fOutBytes);
+         if (res < 0) {
+            if (errno == EINTR)
+               continue;
+            throw std::runtime_error("pread failed, error: " + std::string(std::strerror(errno)));
+         }
+         if (res == 0)
+            return; // end of file
+         ev.fOutBytes += static_cast<std::size_t>(res);
+      }
+   }
+
+public:
+   /// Check whether io_uring can be used on this system, e.g. it may be disabled in the kernel or prohibited by
+   /// seccomp.  The probe is done only once per process.
+   static bool IsAvailable() {
+      static const bool available = []() {
+         try {
+            RIoUring probe(2);
+         } catch (const std::runtime_error &) {
+            return false;
+         }
+         return true;
+      }();
+      return available;
+   }
+
    /// Submit a number of read events and wait for completion. Events are submitted in batches if
-   /// the number of events is larger than the submission queue depth.
+   /// the number of events is larger than the submission queue depth.  Short reads are resubmitted for the
+   /// remaining bytes until the request is complete or the end of the file is reached, such that fOutBytes
+   /// has the same semantics as for pread(). Events that are interrupted more than kMaxRetries times are completed
+   /// with blocking reads.
    void SubmitReadsAndWait(RReadEvent* readEvents, unsigned int nReads) {
-      unsigned int batch = 0;
-      unsigned int batchSize = fDepth;
-      unsigned int readPos = 0;
+      // Indexes of the read events that still have bytes to read; requests that returned short are appended
+      std::vector<unsigned int> pending(nReads);
+      std::vector<unsigned int> nRetries(nReads, 0);
+      for (unsigned int i = 0; i < nReads; ++i) {
+         pending[i] = i;
+         readEvents[i].fOutBytes = 0;
+      }
 
-      while (readPos < nReads) {
-         if (readPos + batchSize > nReads) {
-            batchSize = nReads - readPos;
-         }
+      unsigned int batch = 0;
+      std::size_t readPos = 0;
+      while (readPos < pending.size()) {
+         const std::size_t batchSize = std::min<std::size_t>(fDepth, pending.size() - readPos);
          // prep reads
          struct io_uring_sqe *sqe;
-         for (std::size_t i = readPos; i < readPos + batchSize; ++i) {
+         for (std::size_t j = readPos; j < readPos + batchSize; ++j) {
+            const auto i = pending[j];
             sqe = io_uring_get_sqe(&fRing);
             if (!sqe) {
                throw std::runtime_error("batch " + std::to_string(batch) + ": "
@@ -122,17 +170,17 @@ public:
                throw std::runtime_error("batch " + std::to_string(batch) + ": "
                   + "null read buffer for read request '" + std::to_string(i) + "'");
             }
+            const auto outBytes = readEvents[i].fOutBytes;
             io_uring_prep_read(sqe,
                readEvents[i].fFileDes,
-               readEvents[i].fBuffer,
-               readEvents[i].fSize,
-               readEvents[i].fOffset
+               static_cast<unsigned char *>(readEvents[i].fBuffer) + outBytes,
+               readEvents[i].fSize - outBytes,
+               readEvents[i].fOffset + outBytes
             );
             sqe->flags |= IOSQE_ASYNC; // maximize read event throughput
             sqe->user_data = i;
          }
 
-         // todo(max) check for any difference between submit vs. submit and wait for large nReq
          int submitted = io_uring_submit_and_wait(&fRing, batchSize);
          if (submitted <= 0) {
             throw std::runtime_error("batch " + std::to_string(batch) + ": "
@@ -154,18 +202,28 @@ public:
             if (index >= nReads) {
                throw std::runtime_error("bad cqe user data: " + std::to_string(index));
             }
-            if (cqe->res < 0) {
+            const int res = cqe->res;
+            io_uring_cqe_seen(&fRing, cqe);
+            if (res == -EINTR || res == -EAGAIN) {
+               if (++nRetries[index] > kMaxRetries)
+                  CompleteWithPread(readEvents[index]);
+               else
+                  pending.push_back(index);
+               continue;
+            }
+            if (res < 0) {
                throw std::runtime_error("batch " + std::to_string(batch) + ": "
                   + "read failed for ReadEvent[" + std::to_string(index) + "], "
-                  "error: " + std::string(std::strerror(-cqe->res)));
+                  "error: " + std::string(std::strerror(-res)));
             }
-            readEvents[index].fOutBytes = static_cast<std::size_t>(cqe->res);
-            io_uring_cqe_seen(&fRing, cqe);
+            readEvents[index].fOutBytes += static_cast<std::size_t>(res);
+            // A zero-byte read indicates the end of the file
+            if (res > 0 && readEvents[index].fOutBytes < readEvents[index].fSize)
+               pending.push_back(index);
          }
          readPos += batchSize;
          batch += 1;
       }
-      return;
    }
 };
 
@@ -15,6 +15,8 @@
 #include <ROOT/RRawFile.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include "RConfigure.h"
+
 #include <cstddef>
 #include <cstdint>
 
@@ -31,6 +33,11 @@ namespace Internal {
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes;
+#ifdef R__HAS_URING
+   /// Set if io_uring failed for this file, in which case ReadV() uses blocking reads from then on.
+   /// The ring itself is shared by all files read from the same thread.
+   bool fIsIoUringDisabled = false;
+#endif
 
 protected:
    void OpenImpl() final;
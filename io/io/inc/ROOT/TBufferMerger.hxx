@@ -15,10 +15,13 @@
 #include "TFileMerger.h"
 #include "TMemFile.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <thread>
 
 namespace ROOT {
 
@@ -79,6 +82,58 @@ public:
    /** Returns the current value of the auto save setting in bytes (default = 0). */
    size_t GetAutoSave() const;
 
+   /** Returns the largest number of buffers that were in the queue at once. */
+   size_t GetMaxQueueSize() const
+   {
+      return fMaxQueueSize;
+   }
+
+   /** Returns the total time, in seconds, spent merging buffers into the output file. */
+   double GetMergeTime() const
+   {
+      return fMergeTime * 1e-9;
+   }
+
+   /** Returns the total time, in seconds, that the threads writing to the
+    *  TBufferMergerFiles were blocked, either merging the queue themselves
+    *  or (with the background merge) waiting for room in the queue.
+    */
+   double GetStallTime() const
+   {
+      return fStallTime * 1e-9;
+   }
+
+   /** Returns whether the buffers are merged by a dedicated thread. */
+   bool IsBackgroundMerge() const
+   {
+      return fMergeThread.joinable();
+   }
+
+   /** By default, the buffers are merged by whichever thread writes a
+    *  TBufferMergerFile while no other merge is running, which blocks that
+    *  thread for the duration of the merge. With the background merge, the
+    *  buffers are only queued by the writing threads and a dedicated thread
+    *  merges them into the output file.
+    *  @param enable Start (true) or stop (false) the merging thread. Stopping
+    *  it merges what is left in the queue.
+    *  This must not be called while TBufferMergerFiles are being written.
+    */
+   void SetBackgroundMerge(bool enable = true);
+
+   /** Returns the maximum number of bytes that can be queued with the background merge (0 means no limit). */
+   size_t GetMaxBuffered() const
+   {
+      return fMaxBuffered;
+   }
+
+   /** Bound the memory used by the queue of the background merge: a thread
+    *  writing a TBufferMergerFile waits until the merging thread has taken
+    *  the queued buffers if adding its own would exceed size bytes.
+    *  The default, 0, does not limit the size of the queue. Has no effect
+    *  without the background merge.
+    */
+   void SetMaxBuffered(size_t size);
+
    /** Returns the current merge options. */
    const char* GetMergeOptions();
 
@@ -154,6 +209,7 @@ private:
    void MergeImpl();
 
    void Merge();
+   void MergeLoop();
    void Push(TBufferFile *buffer);
    bool TryMerge(TBufferMergerFile *memfile);
 
@@ -165,6 +221,15 @@ private:
    mutable std::mutex fQueueMutex;                               //< Mutex used to lock fQueue
    std::queue<TBufferFile *> fQueue;                             //< Queue to which data is pushed and merged
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
+   size_t fMaxBuffered{0};                                       //< Maximum number of bytes in the queue with the background merge
+   std::atomic<size_t> fMaxQueueSize{0};                         //< Largest number of buffers in the queue so far
+   std::atomic<long long> fMergeTime{0};                         //< Time spent merging, in nanoseconds
+   std::atomic<long long> fStallTime{0};                         //< Time the writing threads were blocked, in nanoseconds
+   std::thread fMergeThread;                                     //< Thread merging the queue with the background merge
+   std::condition_variable fQueueCondition;                      //< Signals buffers in the queue, or the end of the merging thread
+   std::condition_variable fRoomCondition;                       //< Signals that the merging thread emptied the queue
+   bool fStopMergeThread{false};                                 //< Requests the end of the merging thread
+   size_t fNWaiting{0};                                          //< Number of writing threads waiting for room in the queue
 };
 
 /**
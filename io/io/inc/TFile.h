@@ -115,6 +115,9 @@ protected:
 
    bool             fGlobalRegistration = true; ///<! if true, bypass use of global lists
 
+   char            *fMappedBuffer{nullptr};   ///<!Read-only memory mapping of the whole file (see the "mmap" url option)
+   Long64_t         fMappedSize{0};           ///<!Number of bytes in fMappedBuffer
+
 #ifdef R__USE_IMT
    std::mutex                                 fWriteMutex;  ///<!Lock for writing baskets / keys into the file.
    static ROOT::Internal::RConcurrentHashColl fgTsSIHashes; ///<!TS Set of hashes built from read streamer infos
@@ -140,6 +143,8 @@ protected:
            Bool_t      FlushWriteCache();
            Int_t       ReadBufferViaCache(char *buf, Int_t len);
            Int_t       WriteBufferViaCache(const char *buf, Int_t len);
+           void        MapMemory();
+           void        UnmapMemory();
 
    ////////////////////////////////////////////////////////////////////////////////
    /// \brief Simple struct of the return value of GetStreamerInfoListImpl
@@ -226,6 +231,7 @@ public:
    virtual Int_t       GetErrno() const;
    virtual void        ResetErrno() const;
            Int_t       GetFd() const { return fD; }
+           const char *GetMappedBuffer(Long64_t pos, Int_t len);
    virtual const TUrl *GetEndpointUrl() const { return &fUrl; }
            TObjArray  *GetListOfProcessIDs() const {return fProcessIDs;}
            TList      *GetListOfFree() const { return fFree; }
@@ -251,6 +257,7 @@ public:
    virtual void        IncrementProcessIDs() { fNProcessIDs++; }
    virtual Bool_t      IsArchive() const { return fIsArchive; }
            Bool_t      IsBinary() const { return TestBit(kBinaryFile); }
+           Bool_t      IsMemoryMapped() const { return fMappedBuffer != nullptr; }
            Bool_t      IsRaw() const { return !fIsRootFile; }
    virtual Bool_t      IsOpen() const;
            void        ls(Option_t *option="") const override;
@@ -17,6 +17,7 @@
 #include "TString.h"
 #include "TStopwatch.h"
 #include <string>
+#include <vector>
 
 class TFile;
 class TDirectory;
@@ -54,6 +55,7 @@ protected:
    TString        fObjectNames;               ///< List of object names to be either merged exclusively or skipped
    TList          fMergeList;                 ///< list of TObjString containing the name of the files need to be merged
    TList          fExcessFiles;               ///<! List of TObjString containing the name of the files not yet added to fFileList due to user or system limitation on the max number of files opened.
+   UInt_t         fNThreads{1};               ///<! Number of threads used to read and merge the histograms of a key (default 1)
 
    Bool_t         OpenExcessFiles();
    virtual Bool_t AddFile(TFile *source, Bool_t own, Bool_t cpProgress);
@@ -64,6 +66,8 @@ protected:
                 const TString &path,
                 TDirectory *current_sourcedir, TFile *current_file,
                 TKey *key, TObject *obj, TIter &nextkey);
+   Bool_t         MergeInParallel(TObject *obj, TClass *cl, const std::vector<TDirectory *> &sourcedirs,
+                                  const char *keyname, const char *keytitle, TFileMergeInfo &info);
 public:
    /// Type of the partial merge
    enum EPartialMergeType {
@@ -94,6 +98,8 @@ public:
    void        SetMaxOpenedFiles(Int_t newmax);
    const char *GetMsgPrefix() const { return fMsgPrefix; }
    void        SetMsgPrefix(const char *prefix);
+   UInt_t      GetNThreads() const { return fNThreads; }
+   void        SetNThreads(UInt_t nthreads);
    const char *GetMergeOptions() { return fMergeOptions; }
    void        SetMergeOptions(const TString &options) { fMergeOptions = options; }
    void        SetMergeOptions(const std::string_view &options) { fMergeOptions = options; }
@@ -178,6 +178,7 @@ namespace TStreamerInfoActions {
 
       struct SequencePtr;
       using SequenceGetter_t = SequencePtr(*)(TStreamerInfo *info, TVirtualCollectionProxy *collectionProxy, TClass *originalClass);
+      using FusedAction_t = Int_t (*)(TBuffer &buf, void *obj, const TConfiguredAction *actions);
 
       TActionSequence(TVirtualStreamerInfo *info, UInt_t maxdata, Bool_t isForVecPtr = kFALSE)
          : fStreamerInfo(info), fLoopConfig(0)
@@ -192,9 +193,11 @@ namespace TStreamerInfoActions {
 
       template <typename action_t>
       void AddAction( action_t action, TConfiguration *conf ) {
+         fFusedAction = nullptr;
          fActions.emplace_back( action, conf );
       }
       void AddAction(const TConfiguredAction &action ) {
+         fFusedAction = nullptr;
          fActions.push_back( action );
       }
 
@@ -205,9 +208,11 @@ namespace TStreamerInfoActions {
       TVirtualStreamerInfo *fStreamerInfo; ///< StreamerInfo used to derive these actions.
       TLoopConfiguration   *fLoopConfig;   ///< If this is a bundle of memberwise streaming action, this configures the looping
       ActionContainer_t     fActions;
+      FusedAction_t         fFusedAction = nullptr; ///<! JIT-compiled equivalent of fActions for TBufferFile, see JitFusedAction
 
       void AddToOffset(Int_t delta);
       void SetMissing();
+      Bool_t JitFusedAction(Bool_t read);
 
       TActionSequence *CreateCopy();
       static TActionSequence *CreateReadMemberWiseActions(TVirtualStreamerInfo *info, TVirtualCollectionProxy &proxy);
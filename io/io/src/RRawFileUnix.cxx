@@ -33,6 +33,33 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 4096; // If fstat() does not provide a block size hint, use this value instead
+
+#ifdef R__HAS_URING
+/// The io_uring instance used by ReadV() of all files on the calling thread. One ring per file would quickly exhaust
+/// the locked memory limit (RLIMIT_MEMLOCK) of the user if many files are open at the same time.
+struct RThreadRing {
+   std::unique_ptr<ROOT::Internal::RIoUring> fRing;
+   /// Set if the ring cannot be set up on this thread
+   bool fIsSetupFailed = false;
+};
+
+RThreadRing &GetThreadRing()
+{
+   thread_local RThreadRing threadRing;
+   if (!threadRing.fRing && !threadRing.fIsSetupFailed) {
+      threadRing.fIsSetupFailed = !ROOT::Internal::RIoUring::IsAvailable();
+      if (!threadRing.fIsSetupFailed) {
+         try {
+            threadRing.fRing = std::make_unique<ROOT::Internal::RIoUring>(); // throws std::runtime_error
+         } catch (const std::runtime_error &e) {
+            Warning("RRawFileUnix", "io_uring setup failed, falling back to blocking I/O in ReadV:\n%s", e.what());
+            threadRing.fIsSetupFailed = true;
+         }
+      }
+   }
+   return threadRing;
+}
+#endif
 } // anonymous namespace
 
 ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions options)
@@ -115,10 +142,9 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
 void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
 #ifdef R__HAS_URING
-   thread_local bool uring_failed = false;
-   if (!uring_failed) {
-      try {
-         RIoUring ring; // throws std::runtime_error
+   if (!fIsIoUringDisabled) {
+      auto &threadRing = GetThreadRing();
+      if (threadRing.fRing) {
          std::vector<RIoUring::RReadEvent> reads;
          reads.reserve(nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
@@ -129,17 +155,19 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
             ev.fFileDes = fFileDes;
             reads.push_back(ev);
          }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
-         for (std::size_t i = 0; i < nReq; ++i) {
-            ioVec[i].fOutBytes = reads.at(i).fOutBytes;
+         try {
+            threadRing.fRing->SubmitReadsAndWait(reads.data(), nReq);
+            for (std::size_t i = 0; i < nReq; ++i) {
+               ioVec[i].fOutBytes = reads[i].fOutBytes;
+            }
+            return;
+         } catch (const std::runtime_error &e) {
+            // E.g., the file system does not support io_uring reads; the blocking reads below repeat the full
+            // request. Completions of the failed batch may still be queued, so the ring is set up again on next use.
+            Warning("RRawFileUnix", "io_uring read failed, falling back to blocking I/O in ReadV:\n%s", e.what());
+            threadRing.fRing.reset();
+            fIsIoUringDisabled = true;
          }
-         return;
-      }
-      catch(const std::runtime_error &e) {
-         Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
-         Warning("RRawFileUnix",
-              "io_uring setup failed, falling back to blocking I/O in ReadV");
-         uring_failed = true;
       }
    }
 #endif
@@ -3568,6 +3568,10 @@ Int_t TBufferFile::ApplySequence(const TStreamerInfoActions::TActionSequence &se
          (*iter)(*this,obj);
       }
 
+   } else if (sequence.fFusedAction && IsA() == TBufferFile::Class()) {
+      // all the actions at once, see TStreamerInfo::SetJitActions; the kernel calls the TBufferFile methods
+      // directly, so it would bypass the overrides of a derived buffer such as TBufferSQL
+      sequence.fFusedAction(*this, obj, sequence.fActions.data());
    } else {
       //loop on all active members
       TStreamerInfoActions::ActionContainer_t::const_iterator end = sequence.fActions.end();
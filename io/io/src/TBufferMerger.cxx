@@ -16,10 +16,18 @@
 #include "TROOT.h"
 #include "TVirtualMutex.h"
 
+#include <chrono>
 #include <utility>
 
 namespace ROOT {
 
+namespace {
+long long NanosecondsSince(std::chrono::steady_clock::time_point start)
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+} // anonymous namespace
+
 TBufferMerger::TBufferMerger(const char *name, Option_t *option, Int_t compress)
 {
    // We cannot chain constructors or use in-place initialization here because
@@ -46,6 +54,8 @@ TBufferMerger::~TBufferMerger()
    for (const auto &f : fAttachedFiles)
       if (!f.expired()) Fatal("TBufferMerger", " TBufferMergerFiles must be destroyed before the server");
 
+   SetBackgroundMerge(false);
+
    if (!fQueue.empty())
       Merge();
 
@@ -73,14 +83,40 @@ size_t TBufferMerger::GetQueueSize() const
 
 void TBufferMerger::Push(TBufferFile *buffer)
 {
+   if (IsBackgroundMerge()) {
+      {
+         std::unique_lock<std::mutex> lock(fQueueMutex);
+         if (fMaxBuffered && !fQueue.empty() && fBuffered + buffer->BufferSize() > fMaxBuffered) {
+            // Back-pressure: wait for the merging thread to take the queue.
+            auto start = std::chrono::steady_clock::now();
+            ++fNWaiting;
+            fQueueCondition.notify_one();
+            fRoomCondition.wait(lock, [this] { return fQueue.empty() || fStopMergeThread; });
+            --fNWaiting;
+            fStallTime += NanosecondsSince(start);
+         }
+         fBuffered += buffer->BufferSize();
+         fQueue.push(buffer);
+         if (fQueue.size() > fMaxQueueSize)
+            fMaxQueueSize = fQueue.size();
+      }
+      fQueueCondition.notify_one();
+      return;
+   }
+
    {
       std::lock_guard<std::mutex> lock(fQueueMutex);
       fBuffered += buffer->BufferSize();
       fQueue.push(buffer);
+      if (fQueue.size() > fMaxQueueSize)
+         fMaxQueueSize = fQueue.size();
    }
 
-   if (fBuffered > fAutoSave)
+   if (fBuffered > fAutoSave) {
+      auto start = std::chrono::steady_clock::now();
       Merge();
+      fStallTime += NanosecondsSince(start);
+   }
 }
 
 size_t TBufferMerger::GetAutoSave() const
@@ -104,6 +140,52 @@ void TBufferMerger::SetMergeOptions(const TString& options)
    fMerger.SetMergeOptions(options);
 }
 
+void TBufferMerger::SetMaxBuffered(size_t size)
+{
+   std::lock_guard<std::mutex> lock(fQueueMutex);
+   fMaxBuffered = size;
+}
+
+void TBufferMerger::SetBackgroundMerge(bool enable)
+{
+   if (enable == IsBackgroundMerge())
+      return;
+
+   if (enable) {
+      fStopMergeThread = false;
+      fMergeThread = std::thread(&TBufferMerger::MergeLoop, this);
+      return;
+   }
+
+   {
+      std::lock_guard<std::mutex> lock(fQueueMutex);
+      fStopMergeThread = true;
+   }
+   fQueueCondition.notify_all();
+   fRoomCondition.notify_all();
+   fMergeThread.join();
+
+   // Merge what was queued after the last merge of the thread.
+   if (!fQueue.empty())
+      Merge();
+}
+
+void TBufferMerger::MergeLoop()
+{
+   while (true) {
+      {
+         std::unique_lock<std::mutex> lock(fQueueMutex);
+         fQueueCondition.wait(lock, [this] {
+            return fStopMergeThread || (!fQueue.empty() && (fBuffered > fAutoSave || fNWaiting > 0));
+         });
+         if (fStopMergeThread)
+            return;
+      }
+      std::lock_guard<std::mutex> lock(fMergeMutex);
+      MergeImpl();
+   }
+}
+
 void TBufferMerger::Merge()
 {
    if (fMergeMutex.try_lock()) {
@@ -114,12 +196,15 @@ void TBufferMerger::Merge()
 
 void TBufferMerger::MergeImpl()
 {
+   auto start = std::chrono::steady_clock::now();
    std::queue<TBufferFile *> queue;
    {
       std::lock_guard<std::mutex> q(fQueueMutex);
       std::swap(queue, fQueue);
       fBuffered = 0;
    }
+   // The writing threads waiting for room in the queue can go on.
+   fRoomCondition.notify_all();
 
    while (!queue.empty()) {
       std::unique_ptr<TBufferFile> buffer{queue.front()};
@@ -130,15 +215,22 @@ void TBufferMerger::MergeImpl()
    fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
                         TFileMerger::kKeepCompression);
    fMerger.Reset();
+   fMergeTime += NanosecondsSince(start);
 }
 
 bool TBufferMerger::TryMerge(ROOT::TBufferMergerFile *memfile)
 {
+   // With the background merge, the writing threads never merge.
+   if (IsBackgroundMerge())
+      return false;
+
    if (fMergeMutex.try_lock()) {
+      auto start = std::chrono::steady_clock::now();
       memfile->WriteStreamerInfo();
       fMerger.AddFile(memfile);
       MergeImpl();
       fMergeMutex.unlock();
+      fStallTime += NanosecondsSince(start);
       return true;
    } else
       return false;
@@ -85,6 +85,7 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include <sys/stat.h>
 #ifndef WIN32
 #   include <unistd.h>
+#   include <sys/mman.h>
 #else
 #   define ssize_t int
 #   include <io.h>
@@ -132,6 +133,7 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "compiledata.h"
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <set>
 #include "TSchemaRule.h"
 #include "TSchemaRuleSet.h"
@@ -313,6 +315,16 @@ TFile::TFile() : TDirectoryFile(), fCompress(ROOT::RCompressionSetting::EAlgorit
 /// ~~~{.cpp}
 ///   TFile *f = TFile::Open("tmpname.root?reproducible=fixedname","RECREATE","File title");
 /// ~~~
+///
+/// A local file opened for reading can be memory-mapped by specifying the `"mmap"`
+/// url option (or for all files by setting `TFile.Mmap: yes` in the system.rootrc file):
+/// ~~~{.cpp}
+///   TFile *f = TFile::Open("name.root?mmap");
+/// ~~~
+/// Reads are then served from the mapping instead of system calls, and TKey and
+/// TBasket decompress their records straight from it (see TFile::GetMappedBuffer),
+/// avoiding a copy of the compressed data. The file must not be truncated while it
+/// is mapped. This is not supported on Windows.
 
 TFile::TFile(const char *fname1, Option_t *option, const char *ftitle, Int_t compress)
            : TDirectoryFile(), fCompress(compress), fUrl(fname1,kTRUE)
@@ -502,6 +514,8 @@ TFile::TFile(const char *fname1, Option_t *option, const char *ftitle, Int_t com
          goto zombie;
       }
       fWritable = kFALSE;
+      if (fUrl.HasOption("mmap") || gEnv->GetValue("TFile.Mmap", 0))
+         MapMemory();
    }
 
    // calling virtual methods from constructor not a good idea, but it is how code was developed
@@ -911,6 +925,7 @@ void TFile::Close(Option_t *option)
 
    if (fIsArchive || !fIsRootFile) {
       FlushWriteCache();
+      UnmapMemory();
       SysClose(fD);
       fD = -1;
 
@@ -966,6 +981,7 @@ void TFile::Close(Option_t *option)
    }
 
    if (IsOpen()) {
+      UnmapMemory();
       SysClose(fD);
       fD = -1;
    }
@@ -1678,6 +1694,15 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
          return kFALSE;
       }
 
+      if (fMappedBuffer) {
+         if (const char *mapped = GetMappedBuffer(pos, len)) {
+            memcpy(buf, mapped, len);
+            // leave the file cursor after the buffer, as the system read below does
+            Seek(pos + len);
+            return kFALSE;
+         }
+      }
+
       Seek(pos);
       ssize_t siz;
 
@@ -1723,6 +1748,16 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
          return kFALSE;
       }
 
+      if (fMappedBuffer) {
+         // keep the file cursor where a system read would have left it
+         Long64_t cur = SysSeek(fD, 0, SEEK_CUR);
+         if (const char *mapped = (cur >= 0) ? GetMappedBuffer(cur - fArchiveOffset, len) : nullptr) {
+            memcpy(buf, mapped, len);
+            Seek(len, kCur);
+            return kFALSE;
+         }
+      }
+
       ssize_t siz;
       Double_t start = 0;
 
@@ -1860,6 +1895,71 @@ Int_t TFile::ReadBufferViaCache(char *buf, Int_t len)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Memory-map the whole file for reading, see the "mmap" option of the TFile constructor.
+/// If the mapping fails, the file is read with system calls as usual.
+
+void TFile::MapMemory()
+{
+#ifndef WIN32
+   if (fMappedBuffer || fD < 0)
+      return;
+   struct stat st;
+   if (::fstat(fD, &st) != 0 || st.st_size <= 0 ||
+       static_cast<ULong64_t>(st.st_size) > std::numeric_limits<size_t>::max())
+      return;
+   void *addr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fD, 0);
+   if (addr == MAP_FAILED) {
+      Warning("MapMemory", "cannot memory-map file %s, reading it with system calls", GetName());
+      return;
+   }
+   fMappedBuffer = static_cast<char *>(addr);
+   fMappedSize = st.st_size;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Release the memory mapping of the file, if any.
+
+void TFile::UnmapMemory()
+{
+#ifndef WIN32
+   if (!fMappedBuffer)
+      return;
+   ::munmap(fMappedBuffer, fMappedSize);
+#endif
+   fMappedBuffer = nullptr;
+   fMappedSize = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a pointer to the len bytes at offset pos in the memory mapping of the file,
+/// or nullptr if the file is not memory-mapped or the range is not (entirely) mapped,
+/// for instance because the file grew after it was opened.
+///
+/// The returned memory is read-only and valid until the file is closed. Callers
+/// use it instead of ReadBuffer to avoid copying the record, the read is accounted
+/// for in the file statistics as if ReadBuffer had been called.
+
+const char *TFile::GetMappedBuffer(Long64_t pos, Int_t len)
+{
+   if (!fMappedBuffer || len < 0)
+      return nullptr;
+   const Long64_t offset = pos + fArchiveOffset;
+   if (offset < 0 || offset + len > fMappedSize)
+      return nullptr;
+
+   fBytesRead  += len;
+   fgBytesRead += len;
+   fReadCalls++;
+   fgReadCalls++;
+   if (gMonitoringWriter)
+      gMonitoringWriter->SendFileReadProgress(this);
+   if (gPerfStats)
+      gPerfStats->FileReadEvent(this, len, TTimeStamp());
+   return fMappedBuffer + offset;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read the FREE linked list.
 ///
@@ -2165,6 +2265,7 @@ Int_t TFile::ReOpen(Option_t *mode)
 
       // close readonly file
       if (IsOpen()) {
+         UnmapMemory();
          SysClose(fD);
          fD = -1;
       }
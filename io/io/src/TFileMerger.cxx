@@ -49,7 +49,11 @@ to be merged, like the standalone hadd program.
 #include <sys/resource.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <limits>
+#include <thread>
 
 ClassImp(TFileMerger);
 
@@ -374,16 +378,33 @@ Bool_t TFileMerger::Merge(Bool_t)
 
 namespace {
 
-/// Merge a list of RNTuples
-Long64_t MergeRNTuples(TClass* rntupleHandle, const TString& /* target */, const TList& /* sources */) {
-   if (!rntupleHandle) {
-      return Long64_t(-1);
+/// Merge the RNTuples named keyname of the source files into the target file. The RNTuple merge function expects the
+/// ntuple name, the output file, and the input files in its input list; it writes the merged ntuple itself.
+/// The inputs are the files from current_file on, preceded by the target itself if the ntuple was found there
+/// (incremental merge), so that the entries already merged into the target are kept.
+Long64_t MergeRNTuples(TClass *rntupleHandle, void *obj, const char *keyname, TDirectory *target,
+                       TDirectory *current_sourcedir, TFile *current_file, const TList &sources, TFileMergeInfo &info)
+{
+   ROOT::MergeFunc_t func = rntupleHandle ? rntupleHandle->GetMerge() : nullptr;
+   if (!func || !obj)
+      return -1;
+   if (target != target->GetFile()) {
+      Error("MergeRecursive", "merging RNTuples in subdirectories is not supported (RNTuple %s in %s)", keyname,
+            target->GetPath());
+      return -1;
    }
-   // todo(max) implement rntuple merger
-   // [ ] build complete list of sources (some sources may actually be a directory with RNTuples inside)
-   // [ ] merge them
-   ROOT::MergeFunc_t func = rntupleHandle->GetMerge();
-   return func(static_cast<void*>(rntupleHandle), nullptr, nullptr);
+
+   TObjString name(keyname);
+   TList inputs;
+   inputs.Add(&name);
+   inputs.Add(target->GetFile());
+   if (current_sourcedir == target)
+      inputs.Add(target->GetFile());
+   for (TObject *source = current_file ? current_file : sources.First(); source; source = sources.After(source))
+      inputs.Add(source);
+   Long64_t result = func(obj, &inputs, &info);
+   inputs.Clear("nodelete");
+   return result;
 }
 
 Bool_t IsMergeable(TClass *cl)
@@ -596,14 +617,19 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
    } else if (!cl->IsTObject() && cl->GetMerge()) {
       // merge objects that don't derive from TObject
       if (std::string(keyclassname) == "ROOT::Experimental::RNTuple") {
+         if (alreadyseen) return kTRUE;
          Warning("MergeRecursive", "merging RNTuples is experimental");
-         // todo(max): check if this works when a TDirectory is passed as the first
-         // input argument
-         Long64_t mergeResult = MergeRNTuples(cl, *path, *sourcelist);
+         Long64_t mergeResult = MergeRNTuples(cl, obj, keyname, target, current_sourcedir, current_file, *sourcelist, info);
+         oldkeyname = keyname;
+         info.Reset();
+         if (ownobj)
+            cl->Destructor(obj);
          if (mergeResult < 0) {
             Error("MergeRecursive", "error merging RNTuples");
             return kFALSE;
          }
+         // The merged ntuple has been written to the target file by the merge function
+         return kTRUE;
       } else {
          TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
          Error("MergeRecursive", "Merging objects that don't inherit from TObject is unimplemented (key: %s of type %s in file %s)",
@@ -617,6 +643,9 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
       TList inputs;
       TList todelete;
       Bool_t oneGo = fHistoOneGo && cl->InheritsFrom(R__TH1_Class);
+      // With several threads, TTree::Merge reads the baskets of the next input trees while cloning the current one.
+      if (fNThreads > 1 && cl->InheritsFrom(R__TTree_Class))
+         oneGo = kTRUE;
 
       // Loop over all source files and merge same-name object
       TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
@@ -625,6 +654,16 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
          ROOT::MergeFunc_t func = cl->GetMerge();
          func(obj, &inputs, &info);
          info.fIsFirst = kFALSE;
+      } else if (fNThreads > 1 && cl->InheritsFrom(R__TH1_Class)) {
+         std::vector<TDirectory *> sourcedirs;
+         do {
+            // make sure we are at the correct directory level by cd'ing to path
+            if (TDirectory *ndir = getDirectory(nextsource, target->GetName(), path))
+               sourcedirs.push_back(ndir);
+            nextsource = (TFile*)sourcelist->After( nextsource );
+         } while (nextsource);
+         if (!MergeInParallel(obj, cl, sourcedirs, keyname, keytitle, info))
+            return kTRUE;
       } else {
          do {
             // make sure we are at the correct directory level by cd'ing to path
@@ -804,6 +843,111 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Merge into obj the objects named keyname of the source directories, using
+/// up to fNThreads threads (see SetNThreads).
+///
+/// Each thread handles a fixed, contiguous block of the source directories:
+/// it reads their objects one at a time and merges them, in input order, into
+/// its own partial result. The partial results are then merged into obj in
+/// thread order, so the result does not depend on the scheduling of the threads.
+/// At most two objects per thread are kept in memory.
+/// Returns kFALSE if one of the objects could not be read, in which case
+/// nothing is merged into obj.
+
+Bool_t TFileMerger::MergeInParallel(TObject *obj, TClass *cl, const std::vector<TDirectory *> &sourcedirs,
+                                    const char *keyname, const char *keytitle, TFileMergeInfo &info)
+{
+   ROOT::MergeFunc_t func = cl->GetMerge();
+   const std::size_t nsources = sourcedirs.size();
+   const std::size_t nthreads = std::min<std::size_t>(fNThreads, nsources);
+
+   // One partial result per thread; objects that are not owned by the merger
+   // (already in memory) are never merged into and are kept for the end.
+   struct PartialMerge {
+      TObject *fResult = nullptr;
+      std::vector<TObject *> fNotOwned;
+      std::size_t fUnreadable = std::numeric_limits<std::size_t>::max(); ///< Index of the unreadable source, if any
+   };
+   std::vector<PartialMerge> partials(nthreads);
+   std::atomic<Bool_t> failed{kFALSE};
+
+   auto work = [&](std::size_t slot) {
+      PartialMerge &partial = partials[slot];
+      TFileMergeInfo partialInfo(info.fOutputDirectory);
+      partialInfo.fOptions = info.fOptions;
+      TList inputs;
+      const std::size_t end = (slot + 1) * nsources / nthreads;
+      for (std::size_t i = slot * nsources / nthreads; i < end && !failed; ++i) {
+         TDirectory *ndir = sourcedirs[i];
+         TDirectory::TContext ctxt(ndir);
+         TObject *hobj = ndir->GetList()->FindObject(keyname);
+         Bool_t owned = kFALSE;
+         if (!hobj) {
+            TKey *key = (TKey*)ndir->GetListOfKeys()->FindObject(keyname);
+            if (!key)
+               continue;
+            hobj = key->ReadObj();
+            if (!hobj) {
+               partial.fUnreadable = i;
+               failed = kTRUE;
+               break;
+            }
+            owned = kTRUE;
+         }
+         hobj->ResetBit(kMustCleanup);
+         if (!owned) {
+            partial.fNotOwned.push_back(hobj);
+         } else if (!partial.fResult) {
+            partial.fResult = hobj;
+         } else {
+            inputs.Add(hobj);
+            Long64_t result = func(partial.fResult, &inputs, &partialInfo);
+            partialInfo.fIsFirst = kFALSE;
+            if (result < 0) {
+               Error("MergeRecursive", "calling Merge() on '%s' with the corresponding object in '%s'",
+                     keyname, ndir->GetFile()->GetName());
+            }
+            inputs.Clear();
+            delete hobj;
+         }
+      }
+   };
+
+   std::vector<std::thread> pool;
+   for (std::size_t slot = 1; slot < nthreads; ++slot)
+      pool.emplace_back(work, slot);
+   work(0);
+   for (auto &thread : pool)
+      thread.join();
+
+   TList inputs;
+   TList todelete;
+   std::size_t unreadable = std::numeric_limits<std::size_t>::max();
+   for (auto &partial : partials) {
+      if (partial.fResult) {
+         inputs.Add(partial.fResult);
+         todelete.Add(partial.fResult);
+      }
+      for (auto hobj : partial.fNotOwned)
+         inputs.Add(hobj);
+      unreadable = std::min(unreadable, partial.fUnreadable);
+   }
+
+   if (failed) {
+      Info("MergeRecursive", "could not read object for key {%s, %s}; skipping file %s",
+           keyname, keytitle, sourcedirs[unreadable]->GetFile()->GetName());
+      todelete.Delete();
+      return kFALSE;
+   }
+
+   func(obj, &inputs, &info);
+   info.fIsFirst = kFALSE;
+   inputs.Clear();
+   todelete.Delete();
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Merge all objects in a directory
 ///
@@ -1102,6 +1246,24 @@ void TFileMerger::SetMaxOpenedFiles(Int_t newmax)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the number of threads used to read and merge the histograms.
+///
+/// With more than one thread, the histograms with a given name are read from
+/// the input files and merged concurrently (see MergeInParallel), which
+/// enables the thread safety of ROOT (see ROOT::EnableThreadSafety). The
+/// other objects are merged sequentially. When the implicit multi-threading is
+/// enabled (see ROOT::EnableImplicitMT), the TTrees of all the input files are
+/// given at once to TTree::Merge, which fast clones them in order while the
+/// baskets of the next inputs are read concurrently.
+
+void TFileMerger::SetNThreads(UInt_t nthreads)
+{
+   fNThreads = nthreads > 0 ? nthreads : 1;
+   if (fNThreads > 1)
+      ROOT::EnableThreadSafety();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the prefix to be used when printing informational message.
 
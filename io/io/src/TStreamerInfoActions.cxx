@@ -25,6 +25,11 @@
 #include "TProcessID.h"
 #include "TFile.h"
 
+#include <cctype>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
 static const Int_t kRegrouped = TStreamerInfo::kOffsetL;
 
 // More possible optimizations:
@@ -3230,6 +3235,11 @@ void TStreamerInfo::Compile()
    }
    ComputeSize();
 
+   if (fgJitActions) {
+      fReadObjectWise->JitFusedAction(kTRUE);
+      fWriteObjectWise->JitFusedAction(kFALSE);
+   }
+
    fOptimized = isOptimized;
    SetIsCompiled();
 
@@ -3238,6 +3248,34 @@ void TStreamerInfo::Compile()
    }
 }
 
+std::atomic<Bool_t> TStreamerInfo::fgJitActions{kFALSE};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the object-wise read and write actions of the
+/// TStreamerInfo compiled from now on are fused into a JIT-compiled kernel.
+
+Bool_t TStreamerInfo::GetJitActions()
+{
+   return fgJitActions;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the JIT-compilation of the object-wise read and write
+/// actions of the TStreamerInfo compiled from now on, and return the previous
+/// setting.
+///
+/// When enabled, each sequence containing at least two basic type data
+/// members is replaced, for TBufferFile, by a single function generated with
+/// the interpreter: the basic types are read or written inline and the other
+/// actions are called in order (see TActionSequence::JitFusedAction). This
+/// saves one indirect call per data member for the classes streamed most, at
+/// the price of a compilation for each class version.
+
+Bool_t TStreamerInfo::SetJitActions(Bool_t enable)
+{
+   return fgJitActions.exchange(enable);
+}
+
 template <typename From>
 static void AddReadConvertAction(TStreamerInfoActions::TActionSequence *sequence, Int_t newtype, TConfiguration *conf)
 {
@@ -4188,6 +4226,9 @@ void TStreamerInfoActions::TActionSequence::AddToOffset(Int_t delta)
    // Add the (potentially negative) delta to all the configuration's offset.  This is used by
    // TBranchElement in the case of split sub-object.
 
+   // The offsets are hard-coded in the fused kernel.
+   fFusedAction = nullptr;
+
    TStreamerInfoActions::ActionContainer_t::iterator end = fActions.end();
    for(TStreamerInfoActions::ActionContainer_t::iterator iter = fActions.begin();
        iter != end;
@@ -4205,6 +4246,8 @@ void TStreamerInfoActions::TActionSequence::SetMissing()
    // Add the (potentially negative) delta to all the configuration's offset.  This is used by
    // TBranchElement in the case of split sub-object.
 
+   fFusedAction = nullptr;
+
    TStreamerInfoActions::ActionContainer_t::iterator end = fActions.end();
    for(TStreamerInfoActions::ActionContainer_t::iterator iter = fActions.begin();
        iter != end;
@@ -4234,6 +4277,109 @@ TStreamerInfoActions::TActionSequence *TStreamerInfoActions::TActionSequence::Cr
    return sequence;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of the type handled by the action if it is one of the plain
+/// basic type actions that can be inlined in a fused kernel, nullptr otherwise.
+
+static const char *GetFusableTypeName(const TStreamerInfoActions::TConfiguredAction &action, Bool_t read)
+{
+#define R__FUSABLE_TYPE(type)                                                              \
+   if (read ? action.fAction == &ReadBasicType<type> : action.fAction == &WriteBasicType<type>) \
+      return #type;
+
+   R__FUSABLE_TYPE(Bool_t)
+   R__FUSABLE_TYPE(Char_t)
+   R__FUSABLE_TYPE(Short_t)
+   R__FUSABLE_TYPE(Int_t)
+   R__FUSABLE_TYPE(Long_t)
+   R__FUSABLE_TYPE(Long64_t)
+   R__FUSABLE_TYPE(Float_t)
+   R__FUSABLE_TYPE(Double_t)
+   R__FUSABLE_TYPE(UChar_t)
+   R__FUSABLE_TYPE(UShort_t)
+   R__FUSABLE_TYPE(UInt_t)
+   R__FUSABLE_TYPE(ULong_t)
+   R__FUSABLE_TYPE(ULong64_t)
+#undef R__FUSABLE_TYPE
+
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate, with the interpreter, a function equivalent to the sequence of
+/// actions when applied by a TBufferFile, and store it in fFusedAction.
+///
+/// The basic type data members are read or written inline, with the
+/// non-virtual TBufferFile methods at offsets fixed in the generated code.
+/// All the other actions are called from the generated function, in order.
+/// Returns false, leaving the sequence to be applied action by action, if
+/// there is nothing to gain or if the code could not be compiled.
+
+Bool_t TStreamerInfoActions::TActionSequence::JitFusedAction(Bool_t read)
+{
+   fFusedAction = nullptr;
+   if (!gInterpreter || fLoopConfig || IsForVectorPtrLooper())
+      return kFALSE;
+
+   std::string body;
+   UInt_t nInlined = 0;
+   for (size_t i = 0; i < fActions.size(); ++i) {
+      const char *typeName = GetFusableTypeName(fActions[i], read);
+      if (typeName) {
+         // ReadInt, WriteDouble, ...
+         TString method(typeName, strlen(typeName) - 2);
+         method.Prepend(read ? "Read" : "Write");
+         body += TString::Format("   buf.TBufferFile::%s(*(%s *)(obj + %d));\n", method.Data(), typeName,
+                                 fActions[i].fConfiguration->fOffset).Data();
+         ++nInlined;
+      } else {
+         body += TString::Format("   actions[%lu](b, addr);\n", (unsigned long)i).Data();
+      }
+   }
+   if (nInlined < 2)
+      return kFALSE;
+
+   R__LOCKGUARD(gInterpreterMutex);
+
+   // The generated code only depends on the body: sequences with the same layout, e.g. the ones created again when
+   // a TStreamerInfo is recompiled, share one kernel instead of declaring a new function each time.
+   static std::unordered_map<std::string, FusedAction_t> gKernels;
+   auto cached = gKernels.find(body);
+   if (cached != gKernels.end()) {
+      fFusedAction = cached->second;
+      return fFusedAction != nullptr;
+   }
+
+   TString name = TString::Format("%s_%s_v%d_%lu", read ? "Read" : "Write", fStreamerInfo->GetName(),
+                                  fStreamerInfo->GetClassVersion(), (unsigned long)gKernels.size());
+   for (Ssiz_t c = 0; c < name.Length(); ++c) {
+      if (!isalnum(name[c]))
+         name[c] = '_';
+   }
+
+   TString code = TString::Format("#include \"TBufferFile.h\"\n"
+                                  "#include \"TStreamerInfoActions.h\"\n"
+                                  "namespace ROOT { namespace Internal { namespace StreamerKernels {\n"
+                                  "Int_t %s(TBuffer &b, void *addr, const TStreamerInfoActions::TConfiguredAction *actions)\n"
+                                  "{\n"
+                                  "   TBufferFile &buf = static_cast<TBufferFile &>(b);\n"
+                                  "   char *obj = (char *)addr;\n"
+                                  "   (void)actions;\n"
+                                  "%s"
+                                  "   return 0;\n"
+                                  "}\n"
+                                  "}}}\n",
+                                  name.Data(), body.c_str());
+   if (gInterpreter->Declare(code.Data())) {
+      auto address =
+         gInterpreter->Calc(TString::Format("(Longptr_t)&ROOT::Internal::StreamerKernels::%s;", name.Data()));
+      fFusedAction = reinterpret_cast<FusedAction_t>(address);
+   }
+   // Also remember the failures, not to try again for the same layout
+   gKernels.emplace(body, fFusedAction);
+   return fFusedAction != nullptr;
+}
+
 void TStreamerInfoActions::TActionSequence::AddToSubSequence(TStreamerInfoActions::TActionSequence *sequence,
       const TStreamerInfoActions::TIDs &element_ids,
       Int_t offset,
@@ -43,6 +43,59 @@ TEST(RRawFileUnix, ReadV)
    }
 }
 
+TEST(RRawFileUnix, ReadVEndOfFile)
+{
+   auto file = "test_uring_readv_eof";
+   FileRaii fileGuard(file, "abcdefghij");
+   auto f = RRawFileUnix::Create(file);
+
+   char buffer[3][8];
+   RIOVec iovecs[3];
+   iovecs[0].fBuffer = buffer[0];
+   iovecs[0].fOffset = 0;
+   iovecs[0].fSize = 4;
+   // crosses the end of the file
+   iovecs[1].fBuffer = buffer[1];
+   iovecs[1].fOffset = 7;
+   iovecs[1].fSize = 8;
+   // starts beyond the end of the file
+   iovecs[2].fBuffer = buffer[2];
+   iovecs[2].fOffset = 20;
+   iovecs[2].fSize = 8;
+
+   // The io_uring instance is reused by subsequent calls
+   for (int i = 0; i < 2; ++i) {
+      f->ReadV(iovecs, 3);
+      EXPECT_EQ(4u, iovecs[0].fOutBytes);
+      EXPECT_EQ("abcd", std::string(buffer[0], iovecs[0].fOutBytes));
+      EXPECT_EQ(3u, iovecs[1].fOutBytes);
+      EXPECT_EQ("hij", std::string(buffer[1], iovecs[1].fOutBytes));
+      EXPECT_EQ(0u, iovecs[2].fOutBytes);
+   }
+}
+
+TEST(RRawFileUnix, ReadVManyFiles)
+{
+   // All files read from the same thread share one ring, so that many open files do not exhaust the memlock limit
+   auto file = "test_uring_readv_many";
+   FileRaii fileGuard(file, "abcdefghij");
+
+   std::vector<std::unique_ptr<RRawFile>> files;
+   for (int i = 0; i < 256; ++i)
+      files.emplace_back(RRawFileUnix::Create(file));
+
+   for (auto &f : files) {
+      char buffer[4];
+      RIOVec iovec;
+      iovec.fBuffer = buffer;
+      iovec.fOffset = 2;
+      iovec.fSize = 4;
+      f->ReadV(&iovec, 1);
+      EXPECT_EQ(4u, iovec.fOutBytes);
+      EXPECT_EQ("cdef", std::string(buffer, iovec.fOutBytes));
+   }
+}
+
 TEST(RawUring, NopRoundTrip)
 {
    struct io_uring ring;
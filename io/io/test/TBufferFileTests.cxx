@@ -2,6 +2,9 @@
 
 #include "TBufferFile.h"
 #include "TClass.h"
+#include "TInterpreter.h"
+#include "TStreamerInfo.h"
+#include "TStreamerInfoActions.h"
 #include <vector>
 #include <iostream>
 
@@ -26,3 +29,50 @@ TEST(TBufferFile, ROOT_8367)
    EXPECT_FLOAT_EQ(v2[6], 7.);
    EXPECT_EQ(v2.size(), 7);
 }
+
+TEST(TBufferFile, JitActions)
+{
+   gInterpreter->Declare(R"CODE(
+struct TBufferFileJitActionsTest {
+   Int_t fInt = 0;
+   Double_t fDouble = 0.;
+   std::string fString;
+   Short_t fShort = 0;
+   Long64_t fLong64 = 0;
+};
+)CODE");
+
+   const Bool_t wasEnabled = TStreamerInfo::SetJitActions(kTRUE);
+   TClass *cl = TClass::GetClass("TBufferFileJitActionsTest");
+   ASSERT_NE(cl, nullptr);
+   auto info = static_cast<TStreamerInfo *>(cl->GetStreamerInfo());
+   TStreamerInfo::SetJitActions(wasEnabled);
+
+   EXPECT_NE(info->GetReadObjectWiseActions()->fFusedAction, nullptr);
+   EXPECT_NE(info->GetWriteObjectWiseActions()->fFusedAction, nullptr);
+
+   auto member = [cl](void *obj, const char *name) { return static_cast<char *>(obj) + cl->GetDataMemberOffset(name); };
+
+   void *in = cl->New();
+   *reinterpret_cast<Int_t *>(member(in, "fInt")) = 42;
+   *reinterpret_cast<Double_t *>(member(in, "fDouble")) = 3.5;
+   *reinterpret_cast<std::string *>(member(in, "fString")) = "jit";
+   *reinterpret_cast<Short_t *>(member(in, "fShort")) = -7;
+   *reinterpret_cast<Long64_t *>(member(in, "fLong64")) = 1LL << 40;
+
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteObjectAny(in, cl);
+   buf.SetReadMode();
+   buf.Reset();
+   void *out = buf.ReadObjectAny(cl);
+   ASSERT_NE(out, nullptr);
+
+   EXPECT_EQ(*reinterpret_cast<Int_t *>(member(out, "fInt")), 42);
+   EXPECT_EQ(*reinterpret_cast<Double_t *>(member(out, "fDouble")), 3.5);
+   EXPECT_EQ(*reinterpret_cast<std::string *>(member(out, "fString")), "jit");
+   EXPECT_EQ(*reinterpret_cast<Short_t *>(member(out, "fShort")), -7);
+   EXPECT_EQ(*reinterpret_cast<Long64_t *>(member(out, "fLong64")), 1LL << 40);
+
+   cl->Destructor(in);
+   cl->Destructor(out);
+}
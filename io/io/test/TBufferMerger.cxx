@@ -266,3 +266,69 @@ TEST(TBufferMerger, SetMaxTreeSize)
 
    RemoveFile("tbuffermerger_setmaxtreesize.root");
 }
+
+TEST(TBufferMerger, BackgroundMerge)
+{
+   int nthreads = 4;
+   int nwrites = 8;
+   int nevents = 256;
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger("tbuffermerger_background.root");
+      merger.SetBackgroundMerge();
+      merger.SetMaxBuffered(16 * 1024);
+      EXPECT_TRUE(merger.IsBackgroundMerge());
+
+      std::vector<std::thread> threads;
+      for (int i = 0; i < nthreads; ++i) {
+         threads.emplace_back([=, &merger]() {
+            auto myfile = merger.GetFile();
+            auto mytree = new TTree("mytree", "mytree");
+
+            int n = 0;
+            mytree->Branch("n", &n, "n/I");
+            for (int w = 0; w < nwrites; ++w) {
+               for (int e = 0; e < nevents; ++e) {
+                  n = (i * nwrites + w) * nevents + e;
+                  mytree->Fill();
+               }
+               myfile->Write();
+            }
+            mytree->ResetBranchAddresses();
+         });
+      }
+
+      for (auto &&t : threads)
+         t.join();
+
+      merger.SetBackgroundMerge(false);
+      EXPECT_FALSE(merger.IsBackgroundMerge());
+      EXPECT_EQ(merger.GetQueueSize(), 0u);
+      EXPECT_GT(merger.GetMaxQueueSize(), 0u);
+      EXPECT_GT(merger.GetMergeTime(), 0.);
+   }
+
+   ASSERT_TRUE(FileExists("tbuffermerger_background.root"));
+
+   {
+      TFile f("tbuffermerger_background.root");
+      std::unique_ptr<TTree> t{f.Get<TTree>("mytree")};
+      ASSERT_TRUE(t != nullptr);
+
+      const Long64_t nentries = nthreads * nwrites * nevents;
+      EXPECT_EQ(t->GetEntries(), nentries);
+
+      int n;
+      Long64_t sum = 0;
+      t->SetBranchAddress("n", &n);
+      for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+         t->GetEntry(i);
+         sum += n;
+      }
+      EXPECT_EQ(sum, nentries * (nentries - 1) / 2);
+   }
+
+   RemoveFile("tbuffermerger_background.root");
+}
@@ -2,9 +2,16 @@
 
 #include "TFileMerger.h"
 
+#include "TH1D.h"
 #include "TMemFile.h"
+#include "TROOT.h"
 #include "TTree.h"
 
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
 static void CreateATuple(TMemFile &file, const char *name, double value)
 {
    auto mytree = new TTree(name, "A tree");
@@ -68,3 +75,118 @@ TEST(TFileMerger, CreateWithUnwritableTFilePointer)
    ROOT_EXPECT_ERROR(merger.OutputFile(std::move(output)), "TFileMerger::OutputFile",
                      "output file output.root is not writable");
 }
+
+TEST(TFileMerger, MergeHistogramsInParallel)
+{
+   std::vector<std::unique_ptr<TMemFile>> inputs;
+   for (int i = 0; i < 8; ++i) {
+      inputs.emplace_back(new TMemFile(("hist_input" + std::to_string(i) + ".root").c_str(), "RECREATE"));
+      TH1D h("h", "h", 10, 0, 10);
+      h.SetDirectory(inputs.back().get());
+      for (int j = 0; j <= i; ++j)
+         h.Fill(i);
+      inputs.back()->Write();
+      h.SetDirectory(nullptr);
+   }
+
+   TFileMerger merger;
+   merger.SetNThreads(4);
+   EXPECT_EQ(merger.GetNThreads(), 4u);
+   ASSERT_TRUE(merger.OutputFile(std::unique_ptr<TMemFile>(new TMemFile("hist_output.root", "CREATE"))));
+   for (auto &input : inputs)
+      merger.AddFile(input.get(), false);
+   merger.PartialMerge();
+
+   auto h = merger.GetOutputFile()->Get<TH1D>("h");
+   ASSERT_NE(h, nullptr);
+   EXPECT_EQ(h->GetEntries(), 36);
+   for (int i = 0; i < 8; ++i)
+      EXPECT_EQ(h->GetBinContent(i + 1), i + 1);
+}
+
+TEST(TFileMerger, MergeLabelledHistogramsInParallel)
+{
+   std::vector<std::unique_ptr<TMemFile>> inputs;
+   for (int i = 0; i < 9; ++i) {
+      inputs.emplace_back(new TMemFile(("label_input" + std::to_string(i) + ".root").c_str(), "RECREATE"));
+      TH1D h("h", "h", 1, 0, 1);
+      h.SetDirectory(inputs.back().get());
+      // Every input brings new labels, the merged axis lists them in the order of the inputs
+      h.Fill(("l" + std::to_string(i)).c_str(), 1.);
+      h.Fill(("l" + std::to_string((i * 5) % 9)).c_str(), 0.1 * i);
+      inputs.back()->Write();
+      h.SetDirectory(nullptr);
+   }
+
+   auto merge = [&inputs](UInt_t nthreads) {
+      TFileMerger merger;
+      merger.SetNThreads(nthreads);
+      merger.OutputFile(std::unique_ptr<TMemFile>(new TMemFile("label_output.root", "CREATE")));
+      for (auto &input : inputs)
+         merger.AddFile(input.get(), false);
+      merger.PartialMerge();
+      std::vector<std::pair<std::string, double>> bins;
+      auto h = merger.GetOutputFile()->Get<TH1D>("h");
+      if (h) {
+         for (int i = 1; i <= h->GetNbinsX(); ++i)
+            bins.emplace_back(h->GetXaxis()->GetBinLabel(i), h->GetBinContent(i));
+      }
+      return bins;
+   };
+
+   const auto sequential = merge(1);
+   ASSERT_FALSE(sequential.empty());
+   for (int repeat = 0; repeat < 5; ++repeat)
+      EXPECT_EQ(merge(4), sequential);
+}
+
+#ifdef R__USE_IMT
+TEST(TFileMerger, FastMergeTreesWithReadAhead)
+{
+   const int nInputs = 6;
+   const int nEntries = 5000;
+   std::vector<std::unique_ptr<TMemFile>> inputs;
+   for (int i = 0; i < nInputs; ++i) {
+      inputs.emplace_back(new TMemFile(("tree_input" + std::to_string(i) + ".root").c_str(), "RECREATE"));
+      auto t = new TTree("t", "t");
+      t->SetImplicitMT(false);
+      t->SetDirectory(inputs.back().get());
+      int idx;
+      double x;
+      t->Branch("idx", &idx)->SetBasketSize(1024);
+      t->Branch("x", &x)->SetBasketSize(2048);
+      for (int j = 0; j < nEntries; ++j) {
+         idx = i * nEntries + j;
+         x = 0.5 * idx;
+         t->Fill();
+      }
+      inputs.back()->Write();
+   }
+
+   ROOT::EnableImplicitMT(4);
+   {
+      TFileMerger merger;
+      merger.SetNThreads(4);
+      ASSERT_TRUE(merger.OutputFile(std::unique_ptr<TMemFile>(new TMemFile("tree_output.root", "CREATE"))));
+      for (auto &input : inputs)
+         merger.AddFile(input.get(), false);
+      merger.PartialMerge();
+
+      // The inputs are cloned in order, whichever was read first
+      auto t = merger.GetOutputFile()->Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      ASSERT_EQ(t->GetEntries(), nInputs * nEntries);
+      int idx;
+      double x;
+      t->SetBranchAddress("idx", &idx);
+      t->SetBranchAddress("x", &x);
+      for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+         t->GetEntry(i);
+         EXPECT_EQ(idx, i);
+         EXPECT_EQ(x, 0.5 * i);
+      }
+      t->ResetBranchAddresses();
+   }
+   ROOT::DisableImplicitMT();
+}
+#endif
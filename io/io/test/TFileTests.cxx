@@ -1,3 +1,4 @@
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -85,3 +86,55 @@ TEST(TFile, ReadFromSameFile)
 
    EXPECT_TRUE(o1 != o2) << "Same objects read from two different files have the same pointer!";
 }
+
+TEST(TFile, MemoryMappedRead)
+{
+   const auto filename = "tfile_memory_mapped_read.root";
+   const std::string longTitle(100000, 'x'); // compressed record
+   {
+      TFile f(filename, "RECREATE");
+      TNamed small("small", "not compressed");
+      TNamed large("large", longTitle.c_str());
+      f.WriteObject(&small, small.GetName());
+      f.WriteObject(&large, large.GetName());
+   }
+
+   TFile plain(filename);
+   TFile mapped((std::string(filename) + "?mmap").c_str());
+   ASSERT_FALSE(mapped.IsZombie());
+#ifndef R__WIN32
+   EXPECT_TRUE(mapped.IsMemoryMapped());
+#endif
+   EXPECT_FALSE(plain.IsMemoryMapped());
+
+   auto small = mapped.Get<TNamed>("small");
+   ASSERT_NE(small, nullptr);
+   EXPECT_STREQ(small->GetTitle(), "not compressed");
+   auto large = mapped.Get<TNamed>("large");
+   ASSERT_NE(large, nullptr);
+   EXPECT_EQ(longTitle, large->GetTitle());
+   EXPECT_GT(mapped.GetBytesRead(), 0);
+
+   // Reads through the mapping return the same bytes as system reads
+   const Int_t len = 200;
+   std::vector<char> fromPlain(len), fromMapped(len);
+   EXPECT_FALSE(plain.ReadBuffer(fromPlain.data(), 100, len));
+   EXPECT_FALSE(mapped.ReadBuffer(fromMapped.data(), 100, len));
+   EXPECT_EQ(fromPlain, fromMapped);
+   plain.Seek(150);
+   mapped.Seek(150);
+   EXPECT_FALSE(plain.ReadBuffer(fromPlain.data(), len));
+   EXPECT_FALSE(mapped.ReadBuffer(fromMapped.data(), len));
+   EXPECT_EQ(fromPlain, fromMapped);
+   EXPECT_FALSE(plain.ReadBuffer(fromPlain.data(), len));
+   EXPECT_FALSE(mapped.ReadBuffer(fromMapped.data(), len));
+   EXPECT_EQ(fromPlain, fromMapped);
+
+   // Ranges outside of the file are not mapped
+   EXPECT_EQ(mapped.GetMappedBuffer(mapped.GetSize() - 10, 20), nullptr);
+
+   mapped.Close();
+   EXPECT_FALSE(mapped.IsMemoryMapped());
+   plain.Close();
+   gSystem->Unlink(filename);
+}
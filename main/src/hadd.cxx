@@ -30,6 +30,7 @@
   \param -dbg  Parallelise the execution in multiple processes in debug mode (Does not delete  partial  files  stored
               inside working directory)
   \param -d   Carry out the partial multiprocess execution in the specified directory
+  \param -t   Use `t` threads in each merging process to read and merge the histograms and to read ahead the baskets of the trees
   \param -n   Open at most `n` at once (use 0 to request to use the system maximum)
   \param -experimental-io-features `<feature>` Enables the corresponding experimental feature for output trees
   \return hadd returns a status code: 0 if OK, -1 otherwise
@@ -102,6 +103,7 @@
 #include "TFile.h"
 #include "THashList.h"
 #include "TKey.h"
+#include "TROOT.h"
 #include "TClass.h"
 #include "TSystem.h"
 #include "TUUID.h"
@@ -139,6 +141,7 @@ int main( int argc, char **argv )
    Bool_t keepCompressionAsIs = kFALSE;
    Bool_t useFirstInputCompression = kFALSE;
    Bool_t multiproc = kFALSE;
+   Int_t nThreads = 1;
    Bool_t debug = kFALSE;
    Int_t maxopenedfiles = 0;
    Int_t verbosity = 99;
@@ -213,6 +216,21 @@ int main( int argc, char **argv )
          }
          multiproc = kTRUE;
          ++ffirst;
+      } else if (strcmp(argv[a], "-t") == 0) {
+         if (a + 1 >= argc) {
+            std::cerr << "Error: no number of threads was provided after -t.\n";
+         } else {
+            Long_t request = strtol(argv[a + 1], 0, 10);
+            if (request < kMaxLong && request > 0) {
+               nThreads = (Int_t)request;
+               ++a;
+               ++ffirst;
+            } else {
+               std::cerr << "Error: could not parse the number of threads passed after -t: " << argv[a + 1]
+                         << ". We will use a single thread.\n";
+            }
+         }
+         ++ffirst;
       } else if ( strcmp(argv[a],"-cachesize=") == 0 ) {
          int size;
          static const size_t arglen = strlen("-cachesize=");
@@ -454,6 +472,10 @@ int main( int argc, char **argv )
 #endif
 
    auto mergeFiles = [&](TFileMerger &merger) {
+      // Enabled here, after the worker processes (if any) have been forked.
+      if (nThreads > 1) {
+         ROOT::EnableImplicitMT(nThreads);
+      }
       if (reoptimize) {
          merger.SetFastMethod(kFALSE);
       } else {
@@ -464,6 +486,7 @@ int main( int argc, char **argv )
          }
       }
       merger.SetNotrees(noTrees);
+      merger.SetNThreads(nThreads);
       merger.SetMergeOptions(cacheSize);
       merger.SetIOFeatures(features);
       Bool_t status;
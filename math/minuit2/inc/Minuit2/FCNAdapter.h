@@ -43,6 +43,9 @@ public:
 
    void SetErrorDef(double up) override { fUp = up; }
 
+   bool IsThreadSafe() const override { return fThreadSafe; }
+   void SetThreadSafe(bool on) override { fThreadSafe = on; }
+
    // virtual std::vector<double> Gradient(const std::vector<double>&) const;
 
    // forward interface
@@ -51,6 +54,7 @@ public:
 private:
    const Function &fFunc;
    double fUp;
+   bool fThreadSafe = false;
 };
 
 } // end namespace Minuit2
@@ -104,6 +104,19 @@ public:
        Re-implement this function if needed.
    */
    virtual void SetErrorDef(double){};
+
+   /**
+       Return true if the function can be evaluated concurrently from several threads.
+       In that case, and if ROOT's implicit multithreading is enabled, the numerical
+       derivatives are computed in parallel (see Numerical2PGradientCalculator and MnHesse).
+   */
+   virtual bool IsThreadSafe() const { return false; }
+
+   /**
+       add interface to declare the function as thread safe.
+       Re-implement this function if needed.
+   */
+   virtual void SetThreadSafe(bool) {}
 };
 
 } // namespace Minuit2
@@ -43,6 +43,9 @@ public:
 
    double Up() const override { return fUp; }
 
+   bool IsThreadSafe() const override { return fThreadSafe; }
+   void SetThreadSafe(bool on) override { fThreadSafe = on; }
+
    std::vector<double> Gradient(const std::vector<double> &v) const override
    {
       fFunc.Gradient(&v[0], &fGrad[0]);
@@ -82,6 +85,7 @@ private:
    const Function &fFunc;
    double fUp;
    mutable std::vector<double> fGrad;
+   bool fThreadSafe = false;
 };
 
 } // end namespace Minuit2
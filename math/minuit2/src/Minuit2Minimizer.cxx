@@ -499,6 +499,11 @@ bool Minuit2Minimizer::Minimize()
       if (ret)
          SetStorageLevel(storageLevel);
 
+      // the function can be called concurrently when computing numerical derivatives
+      int threadSafeFCN = 0;
+      if (minuit2Opt->GetValue("ThreadSafeFCN", threadSafeFCN) && fMinuitFCN)
+         fMinuitFCN->SetThreadSafe(threadSafeFCN != 0);
+
       if (printLevel > 0) {
          std::cout << "Minuit2Minimizer::Minuit  - Changing default options" << std::endl;
          minuit2Opt->Print();
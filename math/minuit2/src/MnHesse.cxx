@@ -21,6 +21,19 @@
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/MPIProcess.h"
 
+#ifdef USE_ROOT_ERROR
+#include "RConfigure.h"
+#endif
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+#include <algorithm>
+#include <vector>
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -130,7 +143,18 @@ MinimumState MnHesse::operator()(const MnFcn &mfcn, const MinimumState &st, cons
    print.Debug("Gradient is", st.Gradient().IsAnalytical() ? "analytical" : "numerical", "\n  point:", x,
                "\n  fcn  :", amin, "\n  grad :", grd, "\n  step :", gst, "\n  g2   :", g2);
 
-   for (unsigned int i = 0; i < n; i++) {
+   // the derivatives along the different parameters are computed in parallel
+   // if the function can be called concurrently
+   bool useThreads = false;
+#ifdef R__USE_IMT
+   useThreads = mfcn.Fcn().IsThreadSafe() && ROOT::IsImplicitMTEnabled();
+#endif
+
+   // compute the second derivative along the internal parameter i, moving the
+   // point x (which is restored on return); returns false if it is zero
+   auto computeDiagonal = [&](unsigned int i, MnAlgebraicVector &x) -> bool {
+      // must create a MnPrint instance in each thread
+      MnPrint printDiag("MnHesse", print.Level());
 
       double xtf = x(i);
       double dmin = 8. * prec.Eps2() * (std::fabs(xtf) + prec.Eps2());
@@ -138,7 +162,7 @@ MinimumState MnHesse::operator()(const MnFcn &mfcn, const MinimumState &st, cons
       if (d < dmin)
          d = dmin;
 
-      print.Debug("Derivative parameter", i, "d =", d, "dmin =", dmin);
+      printDiag.Debug("Derivative parameter", i, "d =", d, "dmin =", dmin);
 
       for (unsigned int icyc = 0; icyc < Ncycles(); icyc++) {
          double sag = 0.;
@@ -152,7 +176,7 @@ MinimumState MnHesse::operator()(const MnFcn &mfcn, const MinimumState &st, cons
             x(i) = xtf;
             sag = 0.5 * (fs1 + fs2 - 2. * amin);
 
-            print.Debug("cycle", icyc, "mul", multpy, "\tsag =", sag, "d =", d);
+            printDiag.Debug("cycle", icyc, "mul", multpy, "\tsag =", sag, "d =", d);
 
             //  Now as F77 Minuit - check that sag is not zero
             if (sag != 0)
@@ -169,18 +193,7 @@ MinimumState MnHesse::operator()(const MnFcn &mfcn, const MinimumState &st, cons
          }
 
       L26:
-         // get parameter name for i
-         // (need separate scope for avoiding compl error when declaring name)
-         print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
-                    "; MnHesse fails and will return diagonal matrix");
-
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
-         }
-
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
-                             mfcn.NumOfCalls());
+         return false;
 
       L30:
          double g2bfor = g2(i);
@@ -196,8 +209,8 @@ MinimumState MnHesse::operator()(const MnFcn &mfcn, const MinimumState &st, cons
          if (d < dmin)
             d = dmin;
 
-         print.Debug("g1 =", grd(i), "g2 =", g2(i), "step =", gst(i), "d =", d, "diffd =", std::fabs(d - dlast) / d,
-                     "diffg2 =", std::fabs(g2(i) - g2bfor) / g2(i));
+         printDiag.Debug("g1 =", grd(i), "g2 =", g2(i), "step =", gst(i), "d =", d,
+                         "diffd =", std::fabs(d - dlast) / d, "diffg2 =", std::fabs(g2(i) - g2bfor) / g2(i));
 
          // see if converged
          if (std::fabs((d - dlast) / d) < Tolerstp())
@@ -208,21 +221,64 @@ MinimumState MnHesse::operator()(const MnFcn &mfcn, const MinimumState &st, cons
          d = std::max(d, 0.1 * dlast);
       }
       vhmat(i, i) = g2(i);
-      if (mfcn.NumOfCalls() > maxcalls) {
+      return true;
+   };
 
-         // std::cout<<"maxcalls " << maxcalls << " " << mfcn.NumOfCalls() << "  " <<   st.NFcn() << std::endl;
-         print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
+   // return a diagonal matrix built from the current second derivatives
+   auto diagonalState = [&]() {
+      for (unsigned int j = 0; j < n; j++) {
+         double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
+         vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+      }
 
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+      return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
+                          mfcn.NumOfCalls());
+   };
+
+   // the parameter for which the second derivative is zero, if any
+   unsigned int iZero = n;
+
+   if (useThreads) {
+#ifdef R__USE_IMT
+      // the check on the maximum number of calls is only done at the end
+      std::vector<char> nonZero(n);
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int i) {
+            MnAlgebraicVector xi = x;
+            nonZero[i] = computeDiagonal(i, xi);
+         },
+         ROOT::TSeq<unsigned int>(n));
+      iZero = std::find(nonZero.begin(), nonZero.end(), 0) - nonZero.begin();
+#endif
+   } else {
+      for (unsigned int i = 0; i < n; i++) {
+         if (!computeDiagonal(i, x)) {
+            iZero = i;
+            break;
          }
-
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
-                             mfcn.NumOfCalls());
+         if (mfcn.NumOfCalls() > maxcalls)
+            break;
       }
    }
 
+   if (iZero < n) {
+      // get parameter name for i
+      // (need separate scope for avoiding compl error when declaring name)
+      print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(iZero)),
+                 "; MnHesse fails and will return diagonal matrix");
+
+      return diagonalState();
+   }
+
+   if (mfcn.NumOfCalls() > maxcalls) {
+
+      // std::cout<<"maxcalls " << maxcalls << " " << mfcn.NumOfCalls() << "  " <<   st.NFcn() << std::endl;
+      print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
+
+      return diagonalState();
+   }
+
    print.Debug("Second derivatives", g2);
 
    if (fStrategy.Strategy() > 0) {
@@ -241,6 +297,27 @@ MinimumState MnHesse::operator()(const MnFcn &mfcn, const MinimumState &st, cons
       unsigned int startParIndexOffDiagonal = mpiprocOffDiagonal.StartElementIndex();
       unsigned int endParIndexOffDiagonal = mpiprocOffDiagonal.EndElementIndex();
 
+#ifdef R__USE_IMT
+      // one task per row, if this process computes all the elements
+      if (useThreads && startParIndexOffDiagonal == 0 && endParIndexOffDiagonal == n * (n - 1) / 2) {
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(
+            [&](unsigned int i) {
+               MnAlgebraicVector xi = x;
+               xi(i) += dirin(i);
+               for (unsigned int j = i + 1; j < n; j++) {
+                  xi(j) += dirin(j);
+                  double fs1 = mfcn(xi);
+                  vhmat(i, j) = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
+                  xi(j) -= dirin(j);
+               }
+            },
+            ROOT::TSeq<unsigned int>(n - 1));
+         // nothing left for the sequential loop below
+         startParIndexOffDiagonal = endParIndexOffDiagonal;
+      }
+#endif
+
       unsigned int offsetVect = 0;
       for (unsigned int in = 0; in < startParIndexOffDiagonal; in++)
          if ((in + offsetVect) % (n - 1) == 0)
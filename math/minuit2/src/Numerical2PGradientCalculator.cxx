@@ -9,6 +9,7 @@
 
 #include "Minuit2/Numerical2PGradientCalculator.h"
 #include "Minuit2/InitialGradientCalculator.h"
+#include "Minuit2/FCNBase.h"
 #include "Minuit2/MnFcn.h"
 #include "Minuit2/MnUserTransformation.h"
 #include "Minuit2/MnMachinePrecision.h"
@@ -17,13 +18,24 @@
 #include "Minuit2/MnStrategy.h"
 #include "Minuit2/MnPrint.h"
 
+#ifdef USE_ROOT_ERROR
+#include "RConfigure.h"
+#endif
+
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 #include <cmath>
 #include <cassert>
 #include <iomanip>
+#include <mutex>
 
 #include "Minuit2/MPIProcess.h"
 
@@ -97,35 +109,9 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 
    print.Debug("Calculating gradient around value", fcnmin, "at point", par.Vec());
 
-#ifndef _OPENMP
-
-   MPIProcess mpiproc(n, 0);
-
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
-   // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-   //#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for (int i = 0; i < int(n); i++) {
-
-#endif
-
-#ifdef _OPENMP
-      // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
+   // compute the derivative along the internal parameter i, moving the point x
+   // (which is restored on return)
+   auto computeDerivative = [&](unsigned int i, MnAlgebraicVector &x, std::mutex *printMutex) {
       double xtf = x(i);
       double epspri = eps2 + std::fabs(grd(i) * eps2);
       double stepb4 = 0.;
@@ -169,36 +155,31 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
          grd(i) = 0.5 * (fs1 - fs2) / step;
          g2(i) = (fs1 + fs2 - 2. * fcnmin) / step / step;
 
+         if (print.Level() >= static_cast<int>(MnPrint::eDebug)) {
+            std::unique_lock<std::mutex> printLock;
+            if (printMutex)
+               printLock = std::unique_lock<std::mutex>(*printMutex);
 #ifdef _OPENMP
 #pragma omp critical
 #endif
-         {
-#ifdef _OPENMP
-            // must create thread-local MnPrint instances when printing inside threads
-            MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
-#endif
-            if (i == 0 && j == 0) {
-#ifdef _OPENMP
+            {
+               // must create thread-local MnPrint instances when printing inside threads
+               MnPrint printtl("Numerical2PGradientCalculator", print.Level());
+               if (i == 0 && j == 0) {
+                  printtl.Debug([&](std::ostream &os) {
+                     os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x"
+                        << std::setw(15) << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15)
+                        << "grd" << std::setw(15) << "g2" << std::endl;
+                  });
+               }
                printtl.Debug([&](std::ostream &os) {
-#else
-               print.Debug([&](std::ostream &os) {
-#endif
-                  os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x" << std::setw(15)
-                     << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15) << "grd"
-                     << std::setw(15) << "g2" << std::endl;
+                  const int pr = os.precision(13);
+                  const int iext = Trafo().ExtOfInt(i);
+                  os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
+                     << fs1 << " " << fs2 << " " << grd(i) << " " << g2(i) << std::endl;
+                  os.precision(pr);
                });
             }
-#ifdef _OPENMP
-            printtl.Debug([&](std::ostream &os) {
-#else
-            print.Debug([&](std::ostream &os) {
-#endif
-               const int pr = os.precision(13);
-               const int iext = Trafo().ExtOfInt(i);
-               os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
-                  << fs1 << " " << fs2 << " " << grd(i) << " " << g2(i) << std::endl;
-               os.precision(pr);
-            });
          }
 
          if (std::fabs(grdb4 - grd(i)) / (std::fabs(grd(i)) + dfmin / step) < GradTolerance()) {
@@ -209,12 +190,51 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
             break;
          }
       }
+   };
+
+#ifndef _OPENMP
+
+   MPIProcess mpiproc(n, 0);
+
+   unsigned int startElementIndex = mpiproc.StartElementIndex();
+   unsigned int endElementIndex = mpiproc.EndElementIndex();
 
-      //     vgrd(i) = grd;
-      //     vgrd2(i) = g2;
-      //     vgstp(i) = gstep;
+#ifdef R__USE_IMT
+   if (Fcn().Fcn().IsThreadSafe() && ROOT::IsImplicitMTEnabled()) {
+      // one task per parameter, each with its own copy of the parameter vector
+      std::mutex printMutex;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int i) {
+            MnAlgebraicVector x = par.Vec();
+            computeDerivative(i, x, &printMutex);
+         },
+         ROOT::TSeq<unsigned int>(startElementIndex, endElementIndex));
+   } else
+#endif
+   {
+      // for serial execution this can be outside the loop
+      MnAlgebraicVector x = par.Vec();
+      for (unsigned int i = startElementIndex; i < endElementIndex; i++)
+         computeDerivative(i, x, nullptr);
    }
 
+#else
+
+   // parallelize this loop using OpenMP
+//#define N_PARALLEL_PAR 5
+#pragma omp parallel
+#pragma omp for
+   //#pragma omp for schedule (static, N_PARALLEL_PAR)
+
+   for (int i = 0; i < int(n); i++) {
+      // create in loop since each thread will use its own copy
+      MnAlgebraicVector x = par.Vec();
+      computeDerivative(i, x, nullptr);
+   }
+
+#endif
+
 #ifndef _OPENMP
    mpiproc.SyncVector(grd);
    mpiproc.SyncVector(g2);
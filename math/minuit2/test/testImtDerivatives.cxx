@@ -0,0 +1,106 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2005 LCG ROOT Math team,  CERN/PH-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+// Check that the numerical gradient and the Hessian computed on the ROOT
+// implicit multithreading pool, for a function declared thread safe, are
+// the same as the ones computed sequentially.
+
+#include "Minuit2/FCNBase.h"
+#include "Minuit2/FunctionMinimum.h"
+#include "Minuit2/MnHesse.h"
+#include "Minuit2/MnMigrad.h"
+#include "Minuit2/MnUserParameters.h"
+#include "Minuit2/MnUserParameterState.h"
+#include "TROOT.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace ROOT::Minuit2;
+
+// Extended Rosenbrock function with correlated parameters, safe to evaluate concurrently
+class ThreadSafeRosenbrock : public FCNBase {
+public:
+   double operator()(const std::vector<double> &x) const override
+   {
+      double f = 0;
+      for (unsigned int i = 0; i + 1 < x.size(); ++i) {
+         const double a = x[i + 1] - x[i] * x[i];
+         const double b = 1. - x[i];
+         f += 100. * a * a + b * b;
+      }
+      return f;
+   }
+   double Up() const override { return 1.; }
+   bool IsThreadSafe() const override { return true; }
+};
+
+struct FitResult {
+   std::vector<double> fValues;
+   std::vector<double> fErrors;
+   std::vector<double> fCovariance;
+   bool fValid = false;
+};
+
+FitResult RunFit()
+{
+   const unsigned int npar = 8;
+   ThreadSafeRosenbrock fcn;
+   MnUserParameters upar;
+   for (unsigned int i = 0; i < npar; ++i)
+      upar.Add("x" + std::to_string(i), i % 2 ? 1.2 : -0.8, 0.1);
+
+   // Migrad uses the numerical gradient, Hesse the second derivatives
+   MnMigrad migrad(fcn, upar);
+   FunctionMinimum min = migrad();
+   MnHesse hesse;
+   MnUserParameterState state = hesse(fcn, min.UserParameters());
+
+   FitResult result;
+   result.fValid = min.IsValid() && state.IsValid() && state.HasCovariance();
+   for (unsigned int i = 0; i < npar; ++i) {
+      result.fValues.push_back(min.UserState().Value(i));
+      result.fErrors.push_back(state.Error(i));
+      for (unsigned int j = 0; j < npar; ++j)
+         result.fCovariance.push_back(state.Covariance()(i, j));
+   }
+   return result;
+}
+
+bool Compare(const char *what, const std::vector<double> &seq, const std::vector<double> &par)
+{
+   bool ok = seq.size() == par.size();
+   for (unsigned int i = 0; ok && i < seq.size(); ++i) {
+      if (std::abs(seq[i] - par[i]) > 1.E-8 * (1. + std::abs(seq[i]))) {
+         std::cerr << "Mismatch in " << what << " " << i << ": sequential " << seq[i] << ", parallel " << par[i]
+                   << std::endl;
+         ok = false;
+      }
+   }
+   return ok;
+}
+
+int main()
+{
+   FitResult sequential = RunFit();
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   FitResult parallel = RunFit();
+
+   bool ok = sequential.fValid && parallel.fValid;
+   if (!ok)
+      std::cerr << "Invalid fit result" << std::endl;
+   ok &= Compare("parameter value", sequential.fValues, parallel.fValues);
+   ok &= Compare("parameter error", sequential.fErrors, parallel.fErrors);
+   ok &= Compare("covariance element", sequential.fCovariance, parallel.fCovariance);
+
+   std::cout << "testImtDerivatives: " << (ok ? "OK" : "FAILED") << std::endl;
+   return ok ? 0 : 1;
+}
@@ -31,9 +31,13 @@ functions from `RooBatchCompute` library to provide faster computation times.
 #include "RooFit/Detail/Buffers.h"
 
 #include "ROOT/StringUtils.hxx"
+#include "ROOT/TExecutor.hxx"
+#include "ROOT/TSeq.hxx"
 
 #include "Math/Util.h"
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 #include <stdexcept>
 #include <vector>
@@ -71,6 +75,48 @@ double kahanSum(Input const &input)
    return ROOT::Math::KahanSum<double, 4u>::Accumulate(input.begin(), input.end()).Sum();
 }
 
+/// Number of events in the chunks into which the NLL computation is split. The
+/// chunk boundaries don't depend on the number of threads, such that the
+/// result is bitwise the same with and without implicit multithreading.
+constexpr std::size_t nllChunkSize = 1 << 14;
+
+/// Partial NLL sum of one chunk of events.
+struct NLLChunk {
+   double sum = 0.0;
+   double carry = 0.0;
+   bool valid = true; ///< False if the chunk contains probabilities that need error handling.
+};
+
+/// True if all probabilities are finite and non-negative, i.e. their logarithm
+/// can be taken without having to log evaluation errors.
+bool probabilitiesAreValid(double const *probas, std::size_t n)
+{
+   bool valid = true;
+   for (std::size_t i = 0; i < n; ++i) {
+      valid &= std::isfinite(probas[i]) && probas[i] >= 0.0;
+   }
+   return valid;
+}
+
+/// Compensated sum of the negative log-probabilities in [begin, end), multiplied
+/// by the weights if there are any.
+NLLChunk sumNLLChunk(double const *logProbas, double const *weights, std::size_t begin, std::size_t end)
+{
+   ROOT::Math::KahanSum<double, 4u> sum;
+   if (weights) {
+      for (std::size_t i = begin; i < end; ++i) {
+         // Explicitely add zero if zero weight to get rid of eventual NaNs in
+         // logProbas that have no weight anyway.
+         sum.AddIndexed(weights[i] == 0.0 ? 0.0 : -logProbas[i] * weights[i], i);
+      }
+   } else {
+      for (std::size_t i = begin; i < end; ++i) {
+         sum.AddIndexed(-logProbas[i], i);
+      }
+   }
+   return {sum.Sum(), sum.Carry(), true};
+}
+
 } // namespace
 
 /** Construct a RooNLLVarNew
@@ -119,22 +165,40 @@ void RooNLLVarNew::computeBatch(cudaStream_t * /*stream*/, double *output, size_
    auto probas = dataMap[&*_pdf];
 
    auto logProbasBuffer = ROOT::Experimental::Detail::makeCpuBuffer(nEvents);
-   RooSpan<double> logProbas{logProbasBuffer->cpuWritePtr(), nEvents};
-   (*_pdf).getLogProbabilities(probas, logProbas.data());
-
-   std::vector<double> nlls(nEvents);
-   nlls.reserve(nEvents);
+   double *logProbas = logProbasBuffer->cpuWritePtr();
+   double const *weights = _weight ? dataMap[&**_weight].data() : nullptr;
+
+   // The log-probabilities and the partial sums are computed chunk by chunk,
+   // in parallel if implicit multithreading is enabled. Chunks with invalid
+   // probabilities are left to the sequential fallback below, because logging
+   // the evaluation errors is not thread safe.
+   const std::size_t nChunks = (nEvents + nllChunkSize - 1) / nllChunkSize;
+   auto computeChunk = [&](std::size_t iChunk) {
+      const std::size_t begin = iChunk * nllChunkSize;
+      const std::size_t end = std::min(begin + nllChunkSize, nEvents);
+      if (!probabilitiesAreValid(probas.data() + begin, end - begin)) {
+         NLLChunk chunk;
+         chunk.valid = false;
+         return chunk;
+      }
+      _pdf->getLogProbabilities(RooSpan<const double>{probas.data() + begin, end - begin}, logProbas + begin);
+      return sumNLLChunk(logProbas, weights, begin, end);
+   };
+
+   std::vector<NLLChunk> chunks;
+   if (nChunks > 1) {
+      ROOT::Internal::TExecutor ex;
+      chunks = ex.Map(computeChunk, ROOT::TSeq<std::size_t>(nChunks));
+   } else if (nChunks == 1) {
+      chunks.push_back(computeChunk(0));
+   }
 
-   if (_weight) {
-      double const *weights = dataMap[&**_weight].data();
-      for (std::size_t i = 0; i < nEvents; ++i) {
-         // Explicitely add zero if zero weight to get rid of eventual NaNs in
-         // logProbas that have no weight anyway.
-         nlls.push_back(weights[i] == 0.0 ? 0.0 : -logProbas[i] * weights[i]);
+   if (std::any_of(chunks.begin(), chunks.end(), [](NLLChunk const &chunk) { return !chunk.valid; })) {
+      _pdf->getLogProbabilities(probas, logProbas);
+      for (std::size_t iChunk = 0; iChunk < nChunks; ++iChunk) {
+         const std::size_t begin = iChunk * nllChunkSize;
+         chunks[iChunk] = sumNLLChunk(logProbas, weights, begin, std::min(begin + nllChunkSize, nEvents));
       }
-   } else {
-      for (auto const &p : logProbas)
-         nlls.push_back(-p);
    }
 
    if ((_isExtended || _rangeNormTerm) && _sumWeight == 0.0) {
@@ -168,7 +232,12 @@ void RooNLLVarNew::computeBatch(cudaStream_t * /*stream*/, double *output, size_
       }
    }
 
-   double nll = kahanSum(nlls);
+   // Reduce the partial sums always in the same order
+   ROOT::Math::KahanSum<double> nllSum;
+   for (NLLChunk const &chunk : chunks) {
+      nllSum += ROOT::Math::KahanSum<double>{chunk.sum, chunk.carry};
+   }
+   double nll = nllSum.Sum();
 
    if (std::isnan(nll)) {
       // Special handling of evaluation errors.
@@ -176,7 +245,6 @@ void RooNLLVarNew::computeBatch(cudaStream_t * /*stream*/, double *output, size_
       RooNaNPacker nanPacker;
       for (std::size_t i = 0; i < probas.size(); ++i) {
          if (_weight) {
-            double const *weights = dataMap[&**_weight].data();
             if (std::isnan(logProbas[i]) && weights[i] != 0.0) {
                nanPacker.accumulate(logProbas[i]);
             }
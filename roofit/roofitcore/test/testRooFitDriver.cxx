@@ -22,6 +22,9 @@
 #include "RooMinimizer.h"
 #include "RooFitResult.h"
 
+#include "RConfigure.h"
+#include "TROOT.h"
+
 #include <utility>
 #include <chrono>
 
@@ -94,3 +97,33 @@ TEST(testRooFitDriver, SimpleLikelihoodFit)
    EXPECT_EQ(resultScalar.evalCount, resultBatchNew.evalCount);
    ASSERT_TRUE(resultBatchNew.result->isIdentical(*resultScalar.result));
 }
+
+#ifdef R__USE_IMT
+TEST(testRooFitDriver, ImplicitMTGivesSameLikelihood)
+{
+   RooRealVar x("x", "x", -10, 10);
+
+   RooRealVar mean("mean", "mean", 1, -10, 10);
+   RooRealVar width("width", "width", 2., 0.01, 10);
+   RooGaussian model("model", "model", x, mean, width);
+
+   // enough events for the NLL to be split into several chunks
+   std::unique_ptr<RooDataSet> data{model.generate(x, 100000)};
+
+   ROOT::Experimental::RooNLLVarNew nll("nll", "nll", model, *data->get(), nullptr, false, "");
+   ROOT::Experimental::RooFitDriver driver(*data, nll, x, RooFit::BatchModeOption::Cpu, "");
+
+   const double nllSequential = driver.getVal();
+
+   ROOT::EnableImplicitMT(4);
+   mean.setVal(0.5);
+   const double nllShifted = driver.getVal();
+   mean.setVal(1);
+   const double nllParallel = driver.getVal();
+   ROOT::DisableImplicitMT();
+
+   // the reduction doesn't depend on the number of threads
+   EXPECT_NE(nllShifted, nllParallel);
+   EXPECT_EQ(nllSequential, nllParallel);
+}
+#endif
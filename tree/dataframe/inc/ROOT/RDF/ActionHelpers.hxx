@@ -124,6 +124,8 @@ public:
 
    void InitTask(TTreeReader *, unsigned int) {}
 
+   bool SupportsBatchExec() const final { return true; }
+
    template <typename... Args>
    void Exec(unsigned int slot, Args &&... args)
    {
@@ -149,6 +151,7 @@ public:
    CountHelper(CountHelper &&) = default;
    CountHelper(const CountHelper &) = delete;
    void InitTask(TTreeReader *, unsigned int) {}
+   bool SupportsBatchExec() const final { return true; }
    void Exec(unsigned int slot);
    void Initialize() { /* noop */}
    void Finalize();
@@ -187,6 +190,7 @@ public:
    ReportHelper(ReportHelper &&) = default;
    ReportHelper(const ReportHelper &) = delete;
    void InitTask(TTreeReader *, unsigned int) {}
+   bool SupportsBatchExec() const final { return true; }
    void Exec(unsigned int /* slot */) {}
    void Initialize() { /* noop */}
    void Finalize()
@@ -231,6 +235,7 @@ public:
    BufferedFillHelper(BufferedFillHelper &&) = default;
    BufferedFillHelper(const BufferedFillHelper &) = delete;
    void InitTask(TTreeReader *, unsigned int) {}
+   bool SupportsBatchExec() const final { return true; }
    void Exec(unsigned int slot, double v);
    void Exec(unsigned int slot, double v, double w);
 
@@ -434,6 +439,8 @@ public:
 
    void InitTask(TTreeReader *, unsigned int) {}
 
+   bool SupportsBatchExec() const final { return true; }
+
    // no container arguments
    template <typename... ValTypes,
              typename std::enable_if<!Disjunction<IsDataContainer<ValTypes>...>::value, int>::type = 0>
@@ -543,6 +550,8 @@ public:
    void Initialize() {}
    void InitTask(TTreeReader *, unsigned int) {}
 
+   bool SupportsBatchExec() const final { return true; }
+
    // case: both types are container types
    template <typename X0, typename X1,
              std::enable_if_t<IsDataContainer<X0>::value && IsDataContainer<X1>::value, int> = 0>
@@ -632,6 +641,8 @@ public:
    void Initialize() {}
    void InitTask(TTreeReader *, unsigned int) {}
 
+   bool SupportsBatchExec() const final { return true; }
+
    // case: all types are container types
    template <
       typename X, typename Y, typename EXL, typename EXH, typename EYL, typename EYH,
@@ -742,6 +753,8 @@ public:
 
    void InitTask(TTreeReader *, unsigned int) {}
 
+   bool SupportsBatchExec() const final { return true; }
+
    void Exec(unsigned int slot, T &v) { FillColl(v, *fColls[slot]); }
 
    void Initialize() { /* noop */}
@@ -795,6 +808,8 @@ public:
 
    void InitTask(TTreeReader *, unsigned int) {}
 
+   bool SupportsBatchExec() const final { return true; }
+
    void Exec(unsigned int slot, T &v) { FillColl(v, *fColls[slot]); }
 
    void Initialize() { /* noop */}
@@ -845,6 +860,8 @@ public:
 
    void InitTask(TTreeReader *, unsigned int) {}
 
+   bool SupportsBatchExec() const final { return true; }
+
    void Exec(unsigned int slot, RVec<RealT_t> av) { fColls[slot]->emplace_back(av.begin(), av.end()); }
 
    void Initialize() { /* noop */}
@@ -894,6 +911,8 @@ public:
 
    void InitTask(TTreeReader *, unsigned int) {}
 
+   bool SupportsBatchExec() const final { return true; }
+
    void Exec(unsigned int slot, RVec<RealT_t> av) { fColls[slot]->emplace_back(av.begin(), av.end()); }
 
    void Initialize() { /* noop */}
@@ -959,6 +978,8 @@ public:
    {
    }
 
+   bool SupportsBatchExec() const final { return true; }
+
    void Exec(unsigned int slot, ResultType v) { fMins[slot] = std::min(v, fMins[slot]); }
 
    void InitTask(TTreeReader *, unsigned int) {}
@@ -1017,6 +1038,7 @@ public:
    }
 
    void InitTask(TTreeReader *, unsigned int) {}
+   bool SupportsBatchExec() const final { return true; }
    void Exec(unsigned int slot, ResultType v) { fMaxs[slot] = std::max(v, fMaxs[slot]); }
 
    template <typename T, std::enable_if_t<IsDataContainer<T>::value, int> = 0>
@@ -1089,6 +1111,7 @@ public:
    }
 
    void InitTask(TTreeReader *, unsigned int) {}
+   bool SupportsBatchExec() const final { return true; }
    void Exec(unsigned int slot, ResultType v) { fSums[slot] += v; }
 
    template <typename T, std::enable_if_t<IsDataContainer<T>::value, int> = 0>
@@ -1135,6 +1158,7 @@ public:
    MeanHelper(MeanHelper &&) = default;
    MeanHelper(const MeanHelper &) = delete;
    void InitTask(TTreeReader *, unsigned int) {}
+   bool SupportsBatchExec() const final { return true; }
    void Exec(unsigned int slot, double v);
 
    template <typename T, std::enable_if_t<IsDataContainer<T>::value, int> = 0>
@@ -1190,6 +1214,7 @@ public:
    StdDevHelper(StdDevHelper &&) = default;
    StdDevHelper(const StdDevHelper &) = delete;
    void InitTask(TTreeReader *, unsigned int) {}
+   bool SupportsBatchExec() const final { return true; }
    void Exec(unsigned int slot, double v);
 
    template <typename T, std::enable_if_t<IsDataContainer<T>::value, int> = 0>
@@ -1681,6 +1706,91 @@ public:
    }
 };
 
+/// Type-erased writer of the RNTuple produced by a Snapshot, see SnapshotHelperRNTuple. Every processing slot fills
+/// its own clusters, so that different slots can fill concurrently.
+class RNTupleSnapshotWriter {
+public:
+   virtual ~RNTupleSnapshotWriter() = default;
+   /// Fill one entry through the given slot; values[i] points to the value of the i-th output field
+   virtual void Fill(unsigned int slot, void *const *values) = 0;
+   /// Commit the open clusters of all slots and write the RNTuple footer
+   virtual void Close() = 0;
+   /// The number of entries filled so far by all slots
+   virtual ULong64_t GetNEntries() const = 0;
+};
+
+/// Hooks that provide the RNTuple output of Snapshot. They are set by the RNTuple data source, which is only part of
+/// the library if ROOT is built with root7; RNTuple Snapshots throw if they are unset.
+struct RNTupleSnapshotHooks {
+   using CreateWriter_t = std::function<std::unique_ptr<RNTupleSnapshotWriter>(
+      unsigned int nSlots, const std::string &fileName, const std::string &ntupleName,
+      const ColumnNames_t &fieldNames, const std::vector<std::string> &fieldTypes, const RSnapshotOptions &options)>;
+   /// Creates the data source of the dataframe returned by Snapshot. The RNTuple is opened on first use, because it
+   /// is only written by the Snapshot event loop.
+   using CreateDataSource_t =
+      std::function<std::unique_ptr<ROOT::RDF::RDataSource>(std::string_view ntupleName, std::string_view fileName)>;
+
+   CreateWriter_t fCreateWriter;
+   CreateDataSource_t fCreateDataSource;
+};
+
+RNTupleSnapshotHooks &GetRNTupleSnapshotHooks();
+
+/// Helper object for a Snapshot action that writes an RNTuple, used both in single-thread and multi-thread event
+/// loops. Each processing slot fills its own clusters through the RNTupleSnapshotWriter.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotHelperRNTuple : public RActionImpl<SnapshotHelperRNTuple<ColTypes...>> {
+   const unsigned int fNSlots;
+   const std::string fFileName;
+   const std::string fNTupleName;
+   const RSnapshotOptions fOptions;
+   const ColumnNames_t fOutputFieldNames;
+   std::unique_ptr<RNTupleSnapshotWriter> fWriter;
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotHelperRNTuple(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &bnames, const RSnapshotOptions &options)
+      : fNSlots(nSlots), fFileName(filename), fNTupleName(ntuplename), fOptions(options),
+        fOutputFieldNames(ReplaceDotWithUnderscore(bnames))
+   {
+      if (!dirname.empty())
+         throw std::invalid_argument("Snapshot: RNTuple output to a TFile sub-directory is not supported");
+      ValidateSnapshotOutput(fOptions, fNTupleName, fFileName);
+   }
+   SnapshotHelperRNTuple(const SnapshotHelperRNTuple &) = delete;
+   SnapshotHelperRNTuple(SnapshotHelperRNTuple &&) = default;
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int slot, ColTypes &... values)
+   {
+      void *const addresses[] = {static_cast<void *>(&values)..., nullptr};
+      fWriter->Fill(slot, addresses);
+   }
+
+   void Initialize()
+   {
+      const auto &createWriter = GetRNTupleSnapshotHooks().fCreateWriter;
+      if (!createWriter)
+         throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7=ON");
+      fWriter = createWriter(fNSlots, fFileName, fNTupleName, fOutputFieldNames,
+                             {TypeID2TypeName(typeid(ColTypes))...}, fOptions);
+   }
+
+   void Finalize()
+   {
+      if (fWriter->GetNEntries() == 0) {
+         Warning("Snapshot",
+                 "No input entries (input TTree was empty or no entry passed the Filters). Output RNTuple is empty.");
+      }
+      fWriter->Close();
+      fWriter.reset();
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+};
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class R__CLING_PTRCHECK(off) AggregateHelper
@@ -1708,6 +1818,8 @@ public:
 
    void InitTask(TTreeReader *, unsigned int) {}
 
+   bool SupportsBatchExec() const final { return true; }
+
    template <bool MustCopyAssign_ = MustCopyAssign, std::enable_if_t<MustCopyAssign_, int> = 0>
    void Exec(unsigned int slot, const T &value)
    {
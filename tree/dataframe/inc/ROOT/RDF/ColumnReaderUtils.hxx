@@ -44,7 +44,7 @@ std::unique_ptr<RDFDetail::RColumnReaderBase>
 MakeColumnReader(unsigned int slot, RDefineBase *define,
                  const std::map<std::string, std::vector<void *>> &DSValuePtrsMap, TTreeReader *r,
                  ROOT::RDF::RDataSource *ds, const std::string &colName, RVariationBase *variation,
-                 const std::string &variationName)
+                 const std::string &variationName, RTreeBulkBranches *bulkBranches)
 {
    using Ret_t = std::unique_ptr<RDFDetail::RColumnReaderBase>;
 
@@ -75,7 +75,7 @@ MakeColumnReader(unsigned int slot, RDefineBase *define,
    assert(r != nullptr && "We could not find a reader for this column, this should never happen at this point.");
 
    // reading from a TTree
-   return Ret_t{new RTreeColumnReader<T>(*r, colName)};
+   return MakeTreeColumnReader<T>(*r, colName, bulkBranches);
 }
 
 /// This type aggregates some of the arguments passed to MakeColumnReaders.
@@ -88,6 +88,8 @@ struct RColumnReadersInfo {
    const bool *fIsDefine;
    const std::map<std::string, std::vector<void *>> &fDSValuePtrsMap;
    ROOT::RDF::RDataSource *fDataSource;
+   /// The bulk buffers of the TTree branches, shared by all readers of the processing slot (can be null).
+   RTreeBulkBranches *fBulkBranches = nullptr;
 };
 
 /// Create a group of column readers, one per type in the parameter pack.
@@ -106,6 +108,7 @@ MakeColumnReaders(unsigned int slot, TTreeReader *r, TypeList<ColTypes...>, cons
    const bool *isDefine = colInfo.fIsDefine;
    const auto &DSValuePtrsMap = colInfo.fDSValuePtrsMap;
    auto *ds = colInfo.fDataSource;
+   auto *bulkBranches = colInfo.fBulkBranches;
    const auto &colRegister = colInfo.fCustomCols;
 
    // the i-th element indicates whether variation variationName provides alternative values for the i-th column
@@ -122,11 +125,12 @@ MakeColumnReaders(unsigned int slot, TTreeReader *r, TypeList<ColTypes...>, cons
       {{(++i, MakeColumnReader<ColTypes>(
                  slot, isDefine[i] ? defines.at(colNames[i]).get() : nullptr, DSValuePtrsMap, r, ds, colNames[i],
                  doesVariationApply[i] ? &colRegister.FindVariation(colNames[i], variationName) : nullptr,
-                 variationName))}...}};
+                 variationName, bulkBranches))}...}};
    return ret;
 
    // avoid bogus "unused variable" warnings
    (void)ds;
+   (void)bulkBranches;
    (void)slot;
    (void)r;
 }
@@ -57,6 +57,7 @@ class RInterface;
 using RNode = RInterface<::ROOT::Detail::RDF::RNodeBase, void>;
 class RDataSource;
 } // namespace RDF
+class RDataFrame;
 
 } // namespace ROOT
 
@@ -251,6 +252,10 @@ struct SnapshotHelperArgs {
    ROOT::RDF::RSnapshotOptions fOptions;
 };
 
+/// Create the dataframe that is returned by Snapshot and that reads the snapshotted data
+std::shared_ptr<ROOT::RDataFrame> CreateSnapshotRDF(const ColumnNames_t &validCols, std::string_view fullTreeName,
+                                                    std::string_view fileName, const SnapshotHelperArgs &snapHelperArgs);
+
 // Snapshot action
 template <typename... ColTypes, typename PrevNodeType>
 std::unique_ptr<RActionBase>
@@ -265,7 +270,13 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    const auto &options = snapHelperArgs->fOptions;
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+      // single- and multi-thread RNTuple snapshot
+      using Helper_t = SnapshotHelperRNTuple<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      actionPtr.reset(new Action_t(Helper_t(nSlots, filename, dirname, treename, outputColNames, options), colNames,
+                                   prevNode, colRegister));
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
@@ -23,6 +23,7 @@
 #include <cstddef> // std::size_t
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace ROOT {
@@ -92,7 +93,7 @@ public:
    {
       RDFInternal::RColumnReadersInfo info{RActionBase::GetColumnNames(), RActionBase::GetColRegister(),
                                            fIsDefine.data(), fLoopManager->GetDSValuePtrs(),
-                                           fLoopManager->GetDataSource()};
+                                           fLoopManager->GetDataSource(), fLoopManager->GetTreeBulkBranches(slot)};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
       fHelper.InitTask(r, slot);
    }
@@ -111,6 +112,36 @@ public:
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
    }
 
+   bool CanRunBatch(unsigned int slot) final
+   {
+      if (!fHelper.SupportsBatchExec() || !fPrevNode.CanCheckFiltersBatch(slot))
+         return false;
+      for (auto &v : fValues[slot])
+         if (!v->CanReadBatch())
+            return false;
+      return true;
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void CallExecBatch(unsigned int slot, Long64_t firstEntry, std::size_t n, const char *mask,
+                      TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      // one virtual call per input column, then the helper is invoked in a tight loop
+      std::tuple<ColTypes *...> values{fValues[slot][S]->template GetBatch<ColTypes>(firstEntry, n, mask)...};
+      for (std::size_t i = 0; i < n; ++i) {
+         if (mask[i])
+            fHelper.Exec(slot, std::get<S>(values)[i]...);
+      }
+      (void)values;     // avoid "unused variable" warnings for actions without input columns
+      (void)firstEntry; // avoid "unused parameter" warnings
+   }
+
+   void RunBatch(unsigned int slot, Long64_t firstEntry, std::size_t n) final
+   {
+      const char *mask = fPrevNode.CheckFiltersBatch(slot, firstEntry, n);
+      CallExecBatch(slot, firstEntry, n, mask, ColumnTypes_t{}, TypeInd_t{});
+   }
+
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
 
    /// Clean-up operations to be performed at the end of a task.
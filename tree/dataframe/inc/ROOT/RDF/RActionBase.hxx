@@ -16,6 +16,7 @@
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
+#include <cstddef> // std::size_t
 #include <memory>
 #include <string>
 
@@ -64,6 +65,11 @@ public:
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Whether RunBatch() can be used for the entries of the current data block in the given slot.
+   virtual bool CanRunBatch(unsigned int /*slot*/) { return false; }
+   /// Equivalent to calling Run() for each of the entries [firstEntry, firstEntry + n), but with one virtual call per
+   /// batch and input column. Requires CanRunBatch() to be true.
+   virtual void RunBatch(unsigned int /*slot*/, Long64_t /*firstEntry*/, std::size_t /*n*/) {}
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -71,6 +71,11 @@ public:
    /// Override this method to register a callback that is executed before the processing a new data sample starts.
    /// The callback will be invoked in the same conditions as with DefinePerSample().
    virtual ROOT::RDF::SampleCallback_t GetSampleCallback() { return {}; }
+
+   /// Override this method to return true if Exec() can be called on the entries of a batch in a tight loop.
+   /// In that case the values passed to Exec() have a different address for every entry, so helpers that keep
+   /// pointers to them across calls (e.g. to use them as branch addresses) must not opt in.
+   virtual bool SupportsBatchExec() const { return false; }
 };
 
 } // namespace RDF
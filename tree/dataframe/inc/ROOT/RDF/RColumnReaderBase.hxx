@@ -13,6 +13,8 @@
 
 #include <Rtypes.h>
 
+#include <cstddef>
+
 namespace ROOT {
 namespace Detail {
 namespace RDF {
@@ -38,8 +40,22 @@ public:
       return *static_cast<T *>(GetImpl(entry));
    }
 
+   /// Whether GetBatch() can be used for the entries of the current data block (e.g. the current tree of a chain).
+   virtual bool CanReadBatch() { return false; }
+
+   /// Return the column values of the entries [firstEntry, firstEntry + n) as a contiguous array. Only the values of
+   /// the entries with a non-zero mask flag are guaranteed to be valid; a null mask selects all entries.
+   /// Requires CanReadBatch() to be true.
+   /// 	param T The column type
+   template <typename T>
+   T *GetBatch(Long64_t firstEntry, std::size_t n, const char *mask)
+   {
+      return static_cast<T *>(GetBatchImpl(firstEntry, n, mask));
+   }
+
 private:
    virtual void *GetImpl(Long64_t entry) = 0;
+   virtual void *GetBatchImpl(Long64_t /*firstEntry*/, std::size_t /*n*/, const char * /*mask*/) { return nullptr; }
 };
 
 } // namespace RDF
@@ -22,6 +22,7 @@
 
 #include <array>
 #include <deque>
+#include <tuple>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -66,6 +67,15 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    /// Column readers per slot and per input column
    std::vector<std::array<std::unique_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
 
+   /// Values of the last batch of entries evaluated in a slot, see UpdateBatch().
+   struct RBatch {
+      Long64_t fFirstEntry = -1;
+      RVec<ret_type> fValues;
+      /// The i-th flag is non-zero if the value of the i-th entry of the batch has already been computed.
+      std::vector<char> fIsComputed;
+   };
+   std::vector<RBatch> fBatches;
+
    /// Define objects corresponding to systematic variations other than nominal for this defined column.
    /// The map key is the full variation name, e.g. "pt:up".
    std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
@@ -101,12 +111,48 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
       (void)entry;
    }
 
+   template <typename... Args>
+   ret_type EvalBatchEntry(NoneTag, unsigned int, Long64_t, Args &...args)
+   {
+      return fExpression(args...);
+   }
+
+   template <typename... Args>
+   ret_type EvalBatchEntry(SlotTag, unsigned int slot, Long64_t, Args &...args)
+   {
+      return fExpression(slot, args...);
+   }
+
+   template <typename... Args>
+   ret_type EvalBatchEntry(SlotAndEntryTag, unsigned int slot, Long64_t entry, Args &...args)
+   {
+      return fExpression(slot, entry, args...);
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBatchHelper(unsigned int slot, Long64_t firstEntry, std::size_t n, const char *mask, RBatch &batch,
+                          TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      // input values are only computed for the entries selected by the mask
+      std::tuple<ColTypes *...> values{fValues[slot][S]->template GetBatch<ColTypes>(firstEntry, n, mask)...};
+      for (std::size_t i = 0; i < n; ++i) {
+         if ((mask && !mask[i]) || batch.fIsComputed[i])
+            continue;
+         batch.fValues[i] =
+            EvalBatchEntry(ExtraArgsTag{}, slot, firstEntry + Long64_t(i), std::get<S>(values)[i]...);
+         batch.fIsComputed[i] = 1;
+      }
+      // silence "unused variable" warnings for defines without input columns
+      (void)values;
+   }
+
 public:
    RDefine(std::string_view name, std::string_view type, F expression, const ROOT::RDF::ColumnNames_t &columns,
            const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
            const std::string &variationName = "nominal")
       : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
-        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots())
+        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots()),
+        fBatches(lm.GetNSlots())
    {
    }
 
@@ -116,9 +162,10 @@ public:
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), fLoopManager->GetDSValuePtrs(),
-                                           fLoopManager->GetDataSource()};
+                                           fLoopManager->GetDataSource(), fLoopManager->GetTreeBulkBranches(slot)};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBatches[slot].fFirstEntry = -1;
 
       for (auto &e : fVariedDefines)
          e.second->InitSlot(r, slot);
@@ -142,6 +189,27 @@ public:
 
    void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) final {}
 
+   bool CanUpdateBatch(unsigned int slot) final
+   {
+      for (auto &v : fValues[slot])
+         if (!v->CanReadBatch())
+            return false;
+      return true;
+   }
+
+   /// Compute the values of the entries selected by the mask that were not computed yet for this batch.
+   void *UpdateBatch(unsigned int slot, Long64_t firstEntry, std::size_t n, const char *mask) final
+   {
+      auto &batch = fBatches[slot];
+      if (firstEntry != batch.fFirstEntry || n != batch.fIsComputed.size()) {
+         batch.fValues.resize(n);
+         batch.fIsComputed.assign(n, 0);
+         batch.fFirstEntry = firstEntry;
+      }
+      UpdateBatchHelper(slot, firstEntry, n, mask, batch, ColumnTypes_t{}, TypeInd_t{});
+      return batch.fValues.data();
+   }
+
    const std::type_info &GetTypeId() const { return typeid(ret_type); }
 
    /// Clean-up operations to be performed at the end of a task.
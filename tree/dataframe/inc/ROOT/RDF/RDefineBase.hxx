@@ -17,6 +17,7 @@
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RVec.hxx"
 
+#include <cstddef> // std::size_t
 #include <deque>
 #include <map>
 #include <memory>
@@ -64,6 +65,14 @@ public:
    std::string GetTypeName() const;
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Whether UpdateBatch() can be used for the entries of the current data block in the given slot.
+   virtual bool CanUpdateBatch(unsigned int /*slot*/) { return false; }
+   /// Return the values of the entries [firstEntry, firstEntry + n) as a contiguous array. Only the values of the
+   /// entries with a non-zero mask flag are computed. Requires CanUpdateBatch() to be true.
+   virtual void *UpdateBatch(unsigned int /*slot*/, Long64_t /*firstEntry*/, std::size_t /*n*/, const char * /*mask*/)
+   {
+      return nullptr;
+   }
    /// Update function to be called once per sample, used if the derived type is a RDefinePerSample
    virtual void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) {}
    /// Clean-up operations to be performed at the end of a task.
@@ -16,6 +16,7 @@
 #include "Utils.hxx" // CheckReaderTypeMatches
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
 
+#include <cstddef> // std::size_t
 #include <limits>
 #include <type_traits>
 
@@ -42,12 +43,19 @@ class R__CLING_PTRCHECK(off) RDefineReader final : public ROOT::Detail::RDF::RCo
       return fCustomValuePtr;
    }
 
+   void *GetBatchImpl(Long64_t firstEntry, std::size_t n, const char *mask) final
+   {
+      return fDefine.UpdateBatch(fSlot, firstEntry, n, mask);
+   }
+
 public:
    RDefineReader(unsigned int slot, RDFDetail::RDefineBase &define, const std::type_info &tid)
       : fDefine(define), fCustomValuePtr(define.GetValuePtr(slot)), fSlot(slot)
    {
       CheckReaderTypeMatches(define.GetTypeId(), tid, define.GetName(), "RDefineReader");
    }
+
+   bool CanReadBatch() final { return fDefine.CanUpdateBatch(fSlot); }
 };
 
 }
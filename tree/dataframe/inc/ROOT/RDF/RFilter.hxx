@@ -24,6 +24,7 @@
 #include <cassert>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -64,6 +65,13 @@ class R__CLING_PTRCHECK(off) RFilter final : public RFilterBase {
    const std::shared_ptr<PrevNode> fPrevNodePtr;
    PrevNode &fPrevNode;
 
+   /// Selection mask of the last batch of entries checked in a slot, see CheckFiltersBatch().
+   struct RBatchMask {
+      Long64_t fFirstEntry = -1;
+      std::vector<char> fMask;
+   };
+   std::vector<RBatchMask> fBatchMasks;
+
 public:
    RFilter(FilterF f, const ROOT::RDF::ColumnNames_t &columns, std::shared_ptr<PrevNode> pd,
            const RDFInternal::RColumnRegister &colRegister, std::string_view name = "",
@@ -71,7 +79,7 @@ public:
       : RFilterBase(pd->GetLoopManagerUnchecked(), name, pd->GetLoopManagerUnchecked()->GetNSlots(), colRegister,
                     columns, pd->GetVariations(), variationName),
         fFilter(std::move(f)), fValues(pd->GetLoopManagerUnchecked()->GetNSlots()), fPrevNodePtr(std::move(pd)),
-        fPrevNode(*fPrevNodePtr)
+        fPrevNode(*fPrevNodePtr), fBatchMasks(fValues.size())
    {
    }
 
@@ -110,12 +118,60 @@ public:
       return fFilter(fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
+   bool CanCheckFiltersBatch(unsigned int slot) final
+   {
+      if (!fPrevNode.CanCheckFiltersBatch(slot))
+         return false;
+      for (auto &v : fValues[slot])
+         if (!v->CanReadBatch())
+            return false;
+      return true;
+   }
+
+   const char *CheckFiltersBatch(unsigned int slot, Long64_t firstEntry, std::size_t n) final
+   {
+      auto &batch = fBatchMasks[slot];
+      if (firstEntry != batch.fFirstEntry || n != batch.fMask.size()) {
+         const char *prevMask = fPrevNode.CheckFiltersBatch(slot, firstEntry, n);
+         batch.fMask.resize(n);
+         CheckFilterBatchHelper(slot, firstEntry, prevMask, batch.fMask.data(), n, ColumnTypes_t{}, TypeInd_t{});
+         batch.fFirstEntry = firstEntry;
+      }
+      return batch.fMask.data();
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void CheckFilterBatchHelper(unsigned int slot, Long64_t firstEntry, const char *prevMask, char *mask,
+                               std::size_t n, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      // input values are only computed for the entries that passed the upstream filters
+      std::tuple<ColTypes *...> values{fValues[slot][S]->template GetBatch<ColTypes>(firstEntry, n, prevMask)...};
+      ULong64_t nChecked = 0;
+      ULong64_t nAccepted = 0;
+      for (std::size_t i = 0; i < n; ++i) {
+         if (prevMask[i]) {
+            const bool passed = fFilter(std::get<S>(values)[i]...);
+            mask[i] = passed;
+            nAccepted += passed;
+            ++nChecked;
+         } else {
+            mask[i] = 0;
+         }
+      }
+      fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nAccepted;
+      fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nChecked - nAccepted;
+      // silence "unused variable" warnings for filters without input columns
+      (void)values;
+      (void)firstEntry;
+   }
+
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), fLoopManager->GetDSValuePtrs(),
-                                           fLoopManager->GetDataSource()};
+                                           fLoopManager->GetDataSource(), fLoopManager->GetTreeBulkBranches(slot)};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBatchMasks[slot].fFirstEntry = -1;
    }
 
    // recursive chain of `Report`s
@@ -1065,6 +1065,13 @@ public:
    /// the TTree as part of the TTree name, e.g. `df.Snapshot("subdir/t", "f.root")` write TTree `t` in the
    /// sub-directory `subdir` of file `f.root` (creating file and sub-directory as needed).
    ///
+   /// ### Writing an RNTuple
+   ///
+   /// If RSnapshotOptions::fOutputFormat is set to ESnapshotOutputFormat::kRNTuple, Snapshot writes an RNTuple named
+   /// `treename` instead of a TTree, and the returned RDataFrame reads from that RNTuple. In multi-thread runs, every
+   /// processing slot compresses and writes its own clusters of the RNTuple concurrently with the other slots. Writing
+   /// to a sub-directory is not supported for RNTuple output.
+   ///
    /// \attention In multi-thread runs (i.e. when EnableImplicitMT() has been called) threads will loop over clusters of
    /// entries in an undefined order, so Snapshot will produce outputs in which (clusters of) entries will be shuffled with
    /// respect to the input TTree. Using such "shuffled" TTrees as friends of the original trees would result in wrong
@@ -1134,7 +1141,7 @@ public:
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+      auto newRDF = RDFInternal::CreateSnapshotRDF(validCols, fullTreeName, filename, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          validCols, newRDF, snapHelperArgs, validCols.size());
@@ -3312,7 +3319,7 @@ private:
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+      auto newRDF = RDFInternal::CreateSnapshotRDF(validCols, fullTreeName, filename, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, ColumnTypes...>(validCols, newRDF, snapHelperArgs);
 
@@ -48,6 +48,8 @@ public:
    void SetAction(std::unique_ptr<RActionBase> a) { fConcreteAction = std::move(a); }
 
    void Run(unsigned int slot, Long64_t entry) final;
+   bool CanRunBatch(unsigned int slot) final;
+   void RunBatch(unsigned int slot, Long64_t firstEntry, std::size_t n) final;
    void Initialize() final;
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void TriggerChildrenCount() final;
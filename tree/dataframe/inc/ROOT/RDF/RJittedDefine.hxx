@@ -47,6 +47,8 @@ public:
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
    void Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id) final;
+   bool CanUpdateBatch(unsigned int slot) final;
+   void *UpdateBatch(unsigned int slot, Long64_t firstEntry, std::size_t n, const char *mask) final;
    void FinalizeSlot(unsigned int slot) final;
    void MakeVariations(const std::vector<std::string> &variations) final;
    RDefineBase &GetVariedDefine(const std::string &variationName) final;
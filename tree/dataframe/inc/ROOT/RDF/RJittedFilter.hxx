@@ -47,6 +47,8 @@ public:
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
+   bool CanCheckFiltersBatch(unsigned int slot) final;
+   const char *CheckFiltersBatch(unsigned int slot, Long64_t firstEntry, std::size_t n) final;
    void Report(ROOT::RDF::RCutFlowReport &) const final;
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final;
    void FillReport(ROOT::RDF::RCutFlowReport &) const final;
@@ -15,6 +15,7 @@
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 
+#include <cstddef> // std::size_t
 #include <functional>
 #include <map>
 #include <memory>
@@ -39,6 +40,7 @@ std::vector<std::string> GetBranchNames(TTree &t, bool allowDuplicates = true);
 class GraphNode;
 class RActionBase;
 class RVariationBase;
+class RTreeBulkBranches;
 
 namespace GraphDrawing {
 class GraphCreatorHelper;
@@ -128,6 +130,12 @@ class RLoopManager : public RNodeBase {
    std::vector<ROOT::RDF::SampleCallback_t> fSampleCallbacks;
    RDFInternal::RNewSampleNotifier fNewSampleNotifier;
    std::vector<ROOT::RDF::RSampleInfo> fSampleInfos;
+   /// Per-slot bulk buffers of the TTree branches, shared by the column readers of a task. Null outside of tasks.
+   std::vector<std::shared_ptr<RDFInternal::RTreeBulkBranches>> fTreeBulkBranches;
+   /// Maximum number of entries processed with a single call to each node when running in batches.
+   static constexpr std::size_t fgBatchSize = 1024;
+   /// Selection mask returned by CheckFiltersBatch(): all entries pass.
+   const std::vector<char> fAllPassMask = std::vector<char>(fgBatchSize, 1);
    unsigned int fNRuns{0}; ///< Number of event loops run
 
    /// Registry of per-slot value pointers for booked data-source columns
@@ -144,6 +152,10 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   bool CanRunBatches(unsigned int slot);
+   std::size_t GetBatchSize(TTreeReader &r) const;
+   void RunBatchAndCheckFilters(unsigned int slot, Long64_t firstEntry, std::size_t n);
+   void RunSampleCallbacks(unsigned int slot);
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
@@ -180,6 +192,8 @@ public:
    void Book(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   bool CanCheckFiltersBatch(unsigned int) final { return true; }
+   const char *CheckFiltersBatch(unsigned int, Long64_t, std::size_t) final { return fAllPassMask.data(); }
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -193,6 +207,8 @@ public:
    bool HasDSValuePtrs(const std::string &col) const;
    const std::map<std::string, std::vector<void *>> &GetDSValuePtrs() const { return fDSValuePtrMap; }
    void AddDSValuePtrs(const std::string &col, const std::vector<void *> ptrs);
+   /// Return the bulk buffers of the TTree branches for the task running in the given slot (null if not reading a TTree).
+   RDFInternal::RTreeBulkBranches *GetTreeBulkBranches(unsigned int slot) const { return fTreeBulkBranches[slot].get(); }
 
    /// End of recursive chain of calls, does nothing
    void AddFilterName(std::vector<std::string> &) {}
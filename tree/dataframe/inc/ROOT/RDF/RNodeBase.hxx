@@ -14,6 +14,7 @@
 #include "RtypesCore.h"
 #include "TError.h" // R__ASSERT
 
+#include <cstddef> // std::size_t
 #include <memory>
 #include <string>
 #include <vector>
@@ -59,6 +60,14 @@ public:
    virtual void IncrChildrenCount() = 0;
    virtual void StopProcessing() = 0;
    virtual void AddFilterName(std::vector<std::string> &filters) = 0;
+   /// Whether CheckFiltersBatch() can be used for the entries of the current data block in the given slot.
+   virtual bool CanCheckFiltersBatch(unsigned int /*slot*/) { return false; }
+   /// Return the selection mask of the entries [firstEntry, firstEntry + n): the i-th flag is non-zero if entry
+   /// firstEntry + i passes this node and all upstream filters. Requires CanCheckFiltersBatch() to be true.
+   virtual const char *CheckFiltersBatch(unsigned int /*slot*/, Long64_t /*firstEntry*/, std::size_t /*n*/)
+   {
+      return nullptr;
+   }
    // Helper function for SaveGraph
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>> &visitedMap) = 0;
@@ -14,12 +14,25 @@
 #include "RColumnReaderBase.hxx"
 #include <ROOT/RVec.hxx>
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
+#include <TBranch.h>
+#include <TBufferFile.h>
+#include <TDataType.h>
+#include <TLeaf.h>
+#include <TMathBase.h> // TMath::BinarySearch
+#include <TTree.h>
 #include <TTreeReader.h>
 #include <TTreeReaderValue.h>
 #include <TTreeReaderArray.h>
 
+#include <algorithm> // std::min
+#include <cstring>   // std::memcpy
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
 
 namespace ROOT {
 namespace Internal {
@@ -49,6 +62,198 @@ public:
    ~RTreeColumnReader() { fTreeValue.reset(); }
 };
 
+/// Basket-wise reader of a TTree branch of fundamental type T, shared by all column readers of a processing slot.
+///
+/// Values are served from a buffer filled by TBranch::GetBulkRead(), so that reading an entry costs a bounds check
+/// and a copy instead of a full TTreeReaderValue read. GetBulkEntries() takes ownership of the basket buffer, so all
+/// RDF nodes that read the same column in a slot must share one RTreeBulkBranch (see RTreeBulkBranches): otherwise
+/// every node would decompress each basket again.
+/// Bulk reading requires a plain TBranch with a single, fixed-size leaf of exactly type T that belongs to the tree
+/// currently being processed (i.e. not to a friend).
+template <typename T>
+class RTreeBulkBranch {
+   TTreeReader *fReader;
+   std::string fBranchName;
+   /// The tree for which fBranch was looked up; can be a TChain's current tree.
+   TTree *fTree = nullptr;
+   /// The TChain tree number for which fBranch was looked up.
+   Int_t fTreeNumber = -1;
+   /// The branch read in bulk, or nullptr if the current tree does not allow bulk reading of this column.
+   TBranch *fBranch = nullptr;
+   /// Holds the deserialized values of the entries [fBulkFirst, fBulkFirst + fBulkSize) of the current tree.
+   TBufferFile fBuffer{TBuffer::kWrite, 32 * 1024};
+   Long64_t fBulkFirst = -1;
+   Long64_t fBulkSize = 0;
+   /// Aligned copy of the values of the tree entries [fBatchFirst, fBatchFirst + fBatch.size()), see GetBatch().
+   RVec<T> fBatch;
+   Long64_t fBatchFirst = -1;
+
+   void UpdateBranch(TTree *tree, Int_t treeNumber)
+   {
+      fTree = tree;
+      fTreeNumber = treeNumber;
+      fBranch = nullptr;
+      fBulkFirst = -1;
+      fBulkSize = 0;
+      fBatchFirst = -1;
+      fBatch.clear();
+
+      auto *branch = tree->GetBranch(fBranchName.c_str());
+      if (!branch || branch->IsA() != TBranch::Class() || branch->GetTree() != tree || !branch->SupportsBulkRead())
+         return;
+      auto *leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->UncheckedAt(0));
+      if (leaf->GetLeafCount() || leaf->GetLenStatic() != 1)
+         return;
+      TClass *cl = nullptr;
+      EDataType dataType = kOther_t;
+      if (branch->GetExpectedType(cl, dataType) != 0 || cl || dataType != TDataType::GetType(typeid(T)))
+         return;
+      fBranch = branch;
+   }
+
+   /// Load the basket that contains the given entry of the current tree. Return false if bulk reading failed.
+   bool LoadBasket(Long64_t entry)
+   {
+      fBulkFirst = -1;
+      fBulkSize = 0;
+      const Long64_t *basketEntry = fBranch->GetBasketEntry();
+      const auto basket = TMath::BinarySearch(Long64_t(fBranch->GetWriteBasket() + 1), basketEntry, entry);
+      if (basket < 0)
+         return false;
+      const auto nEntries = fBranch->GetBulkRead().GetBulkEntries(basketEntry[basket], fBuffer);
+      if (nEntries <= 0 || basketEntry[basket] + nEntries <= entry)
+         return false;
+      fBulkFirst = basketEntry[basket];
+      fBulkSize = nEntries;
+      return true;
+   }
+
+   /// Return the address of the serialized value of the given entry of the current tree, or nullptr.
+   /// The address is not necessarily aligned for T.
+   const char *GetBulkValue(Long64_t entry)
+   {
+      if (entry < fBulkFirst || entry >= fBulkFirst + fBulkSize) {
+         if (!LoadBasket(entry))
+            return nullptr;
+      }
+      return fBuffer.GetCurrent() + (entry - fBulkFirst) * sizeof(T);
+   }
+
+public:
+   RTreeBulkBranch(TTreeReader &r, const std::string &branchName) : fReader(&r), fBranchName(branchName) {}
+
+   /// Check whether the column can be read in bulk from the tree currently loaded by the TTreeReader.
+   bool Update()
+   {
+      // The entry number passed by RDF is not necessarily the tree entry (e.g. in multi-thread runs),
+      // so we ask the tree directly.
+      auto *chain = fReader->GetTree();
+      auto *tree = chain->GetTree();
+      const auto treeNumber = chain->GetTreeNumber();
+      if (tree != fTree || treeNumber != fTreeNumber)
+         UpdateBranch(tree, treeNumber);
+      return fBranch != nullptr;
+   }
+
+   /// Copy the value of the current tree entry into `value`. Requires Update() to be true.
+   bool ReadCurrent(T &value)
+   {
+      const char *src = GetBulkValue(fTree->GetReadEntry());
+      if (!src)
+         return false;
+      std::memcpy(&value, src, sizeof(T));
+      return true;
+   }
+
+   /// Return the values of the n tree entries starting at the current one as a contiguous array.
+   /// The entries must belong to the current tree. Requires Update() to be true.
+   T *GetBatch(std::size_t n)
+   {
+      const auto first = fTree->GetReadEntry();
+      if (first == fBatchFirst && n <= fBatch.size())
+         return fBatch.data();
+
+      fBatch.resize(n);
+      std::size_t nCopied = 0;
+      while (nCopied < n) {
+         const auto entry = first + Long64_t(nCopied);
+         const char *src = GetBulkValue(entry);
+         if (!src) {
+            fBatchFirst = -1;
+            throw std::runtime_error("RTreeBulkBranch: could not read entry " + std::to_string(entry) +
+                                     " of branch " + fBranchName + " in bulk.");
+         }
+         const auto nFromBasket = std::min<std::size_t>(n - nCopied, fBulkFirst + fBulkSize - entry);
+         std::memcpy(fBatch.data() + nCopied, src, nFromBasket * sizeof(T));
+         nCopied += nFromBasket;
+      }
+      fBatchFirst = first;
+      return fBatch.data();
+   }
+};
+
+/// The RTreeBulkBranch objects of one processing slot, indexed by branch name.
+///
+/// Column readers of different RDF nodes retrieve their RTreeBulkBranch from here, so that every basket is read and
+/// decompressed once per slot. The registry lives for the duration of a task, like the TTreeReader it refers to.
+class RTreeBulkBranches {
+   std::unordered_map<std::string, std::pair<const std::type_info *, std::shared_ptr<void>>> fBranches;
+
+public:
+   template <typename T>
+   std::shared_ptr<RTreeBulkBranch<T>> Get(TTreeReader &r, const std::string &branchName)
+   {
+      auto &entry = fBranches[branchName];
+      if (entry.second && *entry.first == typeid(T))
+         return std::static_pointer_cast<RTreeBulkBranch<T>>(entry.second);
+      auto branch = std::make_shared<RTreeBulkBranch<T>>(r, branchName);
+      if (!entry.second) {
+         // the first type requested wins: readers of the same branch with a different type will fall back to
+         // TTreeReaderValue anyway, as bulk reading requires an exact type match
+         entry.first = &typeid(T);
+         entry.second = branch;
+      }
+      return branch;
+   }
+};
+
+/// Column reader for TTree branches of fundamental type that deserializes a whole basket at a time.
+///
+/// Values are read through an RTreeBulkBranch shared with the other readers of the same branch in the slot. Whenever
+/// the current tree does not allow bulk reading of the column, the value is read via the TTreeReaderValue as usual.
+template <typename T>
+class R__CLING_PTRCHECK(off) RTreeBulkColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   /// Fallback reader. It is always registered with the TTreeReader, which only reads it upon Get().
+   std::unique_ptr<TTreeReaderValue<T>> fTreeValue;
+   std::shared_ptr<RTreeBulkBranch<T>> fBulkBranch;
+   /// We return a reference to this value to clients: the bulk buffer does not guarantee any alignment.
+   T fValue{};
+
+   void *GetImpl(Long64_t) final
+   {
+      if (fBulkBranch->Update() && fBulkBranch->ReadCurrent(fValue))
+         return &fValue;
+      return fTreeValue->Get();
+   }
+
+   /// The batch starts at the entry the TTreeReader currently points to: the entry numbers passed by RDF are not
+   /// necessarily tree entries.
+   void *GetBatchImpl(Long64_t, std::size_t n, const char *) final { return fBulkBranch->GetBatch(n); }
+
+public:
+   RTreeBulkColumnReader(TTreeReader &r, const std::string &colName, RTreeBulkBranches *bulkBranches)
+      : fTreeValue(std::make_unique<TTreeReaderValue<T>>(r, colName.c_str())),
+        fBulkBranch(bulkBranches ? bulkBranches->Get<T>(r, colName)
+                                 : std::make_shared<RTreeBulkBranch<T>>(r, colName))
+   {
+   }
+
+   /// See RTreeColumnReader for why the TTreeReaderValue is reset explicitly.
+   ~RTreeBulkColumnReader() { fTreeValue.reset(); }
+
+   bool CanReadBatch() final { return fBulkBranch->Update(); }
+};
+
 /// RTreeColumnReader specialization for TTree values read via TTreeReaderArrays.
 ///
 /// TTreeReaderArrays are used whenever the RDF column type is RVec<T>.
@@ -176,6 +381,30 @@ public:
    ~RTreeColumnReader() { fTreeArray.reset(); }
 };
 
+template <typename T>
+std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+MakeTreeColumnReader(TTreeReader &r, const std::string &colName, RTreeBulkBranches *bulkBranches,
+                     std::true_type /*isFundamental*/)
+{
+   return std::make_unique<RTreeBulkColumnReader<T>>(r, colName, bulkBranches);
+}
+
+template <typename T>
+std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+MakeTreeColumnReader(TTreeReader &r, const std::string &colName, RTreeBulkBranches *, std::false_type /*isFundamental*/)
+{
+   return std::make_unique<RTreeColumnReader<T>>(r, colName);
+}
+
+/// Return the column reader for a TTree branch: fundamental types are read basket-wise when possible.
+/// Readers created with the same bulkBranches share their bulk buffers; bulkBranches can be null.
+template <typename T>
+std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+MakeTreeColumnReader(TTreeReader &r, const std::string &colName, RTreeBulkBranches *bulkBranches = nullptr)
+{
+   return MakeTreeColumnReader<T>(r, colName, bulkBranches, std::is_arithmetic<T>{});
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
@@ -162,7 +162,7 @@ public:
       for (auto &define : fColumnRegister.GetColumns())
          define.second->InitSlot(r, slot);
       RColumnReadersInfo info{fInputColumns, fColumnRegister, fIsDefine.data(), fLoopManager->GetDSValuePtrs(),
-                              fLoopManager->GetDataSource()};
+                              fLoopManager->GetDataSource(), fLoopManager->GetTreeBulkBranches(slot)};
       fValues[slot] = MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
       fLastCheckedEntry[slot * CacheLineStep<Long64_t>()] = -1;
    }
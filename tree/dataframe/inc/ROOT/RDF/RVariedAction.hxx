@@ -102,7 +102,8 @@ public:
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
       RDFInternal::RColumnReadersInfo info{GetColumnNames(), GetColRegister(), fIsDefine.data(),
-                                           fLoopManager->GetDSValuePtrs(), fLoopManager->GetDataSource()};
+                                           fLoopManager->GetDSValuePtrs(), fLoopManager->GetDataSource(),
+                                           fLoopManager->GetTreeBulkBranches(slot)};
 
       // get readers for the nominal case + each systematic variation
       fInputValues[slot].emplace_back(MakeColumnReaders(slot, r, ColumnTypes_t{}, info /*, "nominal"*/));
@@ -197,6 +197,12 @@ void InterpreterDeclare(const std::string &code);
 /// The pointer returned by the call to TInterpreter::Calc is returned in case of success.
 Long64_t InterpreterCalc(const std::string &code, const std::string &context = "");
 
+/// Like InterpreterCalc, but go through the on-disk cache of compiled jitted code if RDataFrame.JitCacheDir is set:
+/// the code is compiled once into a shared library and later processes with the same code load that library instead.
+/// Addresses in the code are passed at run time, so that the cached library does not depend on them.
+/// Fall back to InterpreterCalc if the code cannot be compiled outside of the interpreter.
+Long64_t InterpreterCalcCached(const std::string &code, const std::string &context = "");
+
 /// Whether custom column with name colName is an "internal" column such as rdfentry_ or rdfslot_
 bool IsInternalColumn(std::string_view colName);
 
@@ -57,6 +57,11 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
 
+   /// Set by SetEntryRangeFilter(); if valid, only the entry ranges that may pass the filter are processed
+   DescriptorId_t fFilterFieldId = kInvalidDescriptorId;
+   double fFilterMin = 0;
+   double fFilterMax = 0;
+
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
    /// AddField recurses into the sub fields. The skeinIDs is the list of field IDs of the outer collections
    /// of fieldId. For instance, if fieldId refers to an `std::vector<Jet>`, with
@@ -82,6 +87,12 @@ public:
 
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
+   /// Restrict the processed entries to the clusters and pages that may contain values of the given top-level
+   /// arithmetic field in [min, max], according to the value ranges stored with the data
+   /// (see RNTupleWriteOptions::SetUseValueRanges()).  This is an optimization only: entries outside [min, max]
+   /// can still be processed, so the corresponding RDataFrame Filter() is still needed.
+   void SetEntryRangeFilter(std::string_view fieldName, double min, double max);
+
    void Initialize() final;
    void Finalize() final;
 
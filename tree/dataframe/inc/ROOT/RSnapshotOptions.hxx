@@ -18,6 +18,14 @@
 namespace ROOT {
 
 namespace RDF {
+
+/// The on-disk format of the dataset written by Snapshot
+enum class ESnapshotOutputFormat {
+   kDefault, ///< Currently TTree
+   kTTree,
+   kRNTuple ///< Requires ROOT built with root7; the RNTuple has the name that is given to Snapshot as tree name
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::ECompressionAlgorithm;
@@ -37,6 +45,7 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                       ///< Split level of output tree
    bool fLazy = false;                         ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kDefault; ///< Write a TTree or an RNTuple
 };
 } // ns RDF
 } // ns ROOT
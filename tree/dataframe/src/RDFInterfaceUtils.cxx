@@ -620,6 +620,24 @@ ParsedTreePath ParseTreePath(std::string_view fullTreeName)
    return {std::string(treeName), std::string(dirName)};
 }
 
+std::shared_ptr<ROOT::RDataFrame> CreateSnapshotRDF(const ColumnNames_t &validCols, std::string_view fullTreeName,
+                                                    std::string_view fileName, const SnapshotHelperArgs &snapHelperArgs)
+{
+   if (snapHelperArgs.fOptions.fOutputFormat != ROOT::RDF::ESnapshotOutputFormat::kRNTuple)
+      return std::make_shared<ROOT::RDataFrame>(fullTreeName, fileName, validCols);
+
+   const auto &createDataSource = GetRNTupleSnapshotHooks().fCreateDataSource;
+   if (!createDataSource)
+      throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7=ON");
+   return std::make_shared<ROOT::RDataFrame>(createDataSource(snapHelperArgs.fTreeName, fileName));
+}
+
+RNTupleSnapshotHooks &GetRNTupleSnapshotHooks()
+{
+   static RNTupleSnapshotHooks hooks;
+   return hooks;
+}
+
 std::string PrettyPrintAddr(const void *const addr)
 {
    std::stringstream s;
@@ -20,16 +20,24 @@
 #include "TClass.h"
 #include "TClassEdit.h"
 #include "TClassRef.h"
+#include "TEnv.h"
 #include "TError.h" // Info
 #include "TInterpreter.h"
 #include "TLeaf.h"
+#include "TMD5.h"
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
+#include "TStopwatch.h"
+#include "TSystem.h"
 #include "TTree.h"
 
+#include <cctype>
+#include <cstdint>
+#include <fstream>
 #include <stdexcept>
 #include <string>
 #include <cstring>
 #include <typeinfo>
+#include <vector>
 
 using namespace ROOT::Detail::RDF;
 using namespace ROOT::RDF;
@@ -317,6 +325,14 @@ std::vector<std::string> ReplaceDotWithUnderscore(const std::vector<std::string>
    return newColNames;
 }
 
+/// All the code successfully declared through InterpreterDeclare so far, in declaration order.
+/// Code jitted through InterpreterCalcCached might refer to any of it.
+static std::string &GetDeclaredCode()
+{
+   static std::string code;
+   return code;
+}
+
 void InterpreterDeclare(const std::string &code)
 {
    R__LOG_DEBUG(10, RDFLogChannel()) << "Declaring the following code to cling:\n\n" << code << '\n';
@@ -327,6 +343,7 @@ void InterpreterDeclare(const std::string &code)
          "the crash\n All RDF objects that have not run an event loop yet should be considered in an invalid state.\n";
       throw std::runtime_error(msg);
    }
+   GetDeclaredCode().append(code).append("\n");
 }
 
 Long64_t InterpreterCalc(const std::string &code, const std::string &context)
@@ -365,6 +382,147 @@ Long64_t InterpreterCalc(const std::string &code, const std::string &context)
    return 0; // we used to forward the return value of Calc, but that's not possible anymore.
 }
 
+/// Return the directory of the on-disk cache of jitted code, empty if the cache is disabled.
+static std::string GetJitCacheDir()
+{
+   if (const char *env = gSystem->Getenv("ROOT_RDF_JIT_CACHE_DIR"))
+      return env;
+   return gEnv->GetValue("RDataFrame.JitCacheDir", "");
+}
+
+/// Replace the addresses (hexadecimal literals, see PrettyPrintAddr) appearing in jitted code outside of string
+/// literals with reads from the `__rdf_addr` array, so that the code does not depend on the running process anymore.
+/// The addresses are appended to `addresses` in the order in which they are referenced.
+static std::string AbstractAddresses(const std::string &code, std::vector<void *> &addresses)
+{
+   std::string out;
+   out.reserve(code.size());
+   char quote = 0;
+   for (std::size_t i = 0; i < code.size(); ++i) {
+      const char c = code[i];
+      if (quote) {
+         out += c;
+         if (c == '\\' && i + 1 < code.size())
+            out += code[++i];
+         else if (c == quote)
+            quote = 0;
+         continue;
+      }
+      if (c == '"' || c == '\'') {
+         quote = c;
+      } else if (c == '0' && i + 2 < code.size() && code[i + 1] == 'x' && std::isxdigit(code[i + 2]) &&
+                 (i == 0 || !(std::isalnum(code[i - 1]) || code[i - 1] == '_'))) {
+         std::size_t end = i + 2;
+         while (end < code.size() && std::isxdigit(code[end]))
+            ++end;
+         const auto addr = std::stoull(code.substr(i + 2, end - i - 2), nullptr, 16);
+         out += "__rdf_addr[" + std::to_string(addresses.size()) + "]";
+         addresses.push_back(reinterpret_cast<void *>(static_cast<std::uintptr_t>(addr)));
+         i = end - 1;
+         continue;
+      }
+      out += c;
+   }
+   return out;
+}
+
+/// Compile `source` into the shared library `library` with the same command ACLiC uses, see TSystem::SetMakeSharedLib.
+/// The compiler output goes to `log`. Return true in case of success.
+static bool CompileJitLibrary(const std::string &dir, const std::string &libName, const std::string &source,
+                              const std::string &library, const std::string &log)
+{
+   TString objFile = source.c_str();
+   objFile.Remove(objFile.Last('.'));
+   objFile += ".";
+   objFile += gSystem->GetObjExt();
+
+   TString cmd = gSystem->GetMakeSharedLib();
+   cmd.ReplaceAll("$SourceFiles", ("\"" + source + "\"").c_str());
+   cmd.ReplaceAll("$ObjectFiles", "\"" + objFile + "\"");
+   cmd.ReplaceAll("$IncludePath", gSystem->GetIncludePath());
+   cmd.ReplaceAll("$SharedLib", ("\"" + library + "\"").c_str());
+   cmd.ReplaceAll("$DepLibs", gSystem->GetLinkedLibs());
+   cmd.ReplaceAll("$LinkedLibs", gSystem->GetLinkedLibs());
+   cmd.ReplaceAll("$LibName", libName.c_str());
+   cmd.ReplaceAll("$BuildDir", ("\"" + dir + "\"").c_str());
+   cmd.ReplaceAll("$Opt", gSystem->GetFlagsOpt());
+#ifndef WIN32
+   cmd = "( " + cmd + " ) > \"" + log.c_str() + "\" 2>&1";
+#else
+   (void)log;
+#endif
+
+   const bool ok = gSystem->Exec(cmd) == 0 && !gSystem->AccessPathName(library.c_str());
+   gSystem->Unlink(objFile);
+   return ok;
+}
+
+Long64_t InterpreterCalcCached(const std::string &code, const std::string &context)
+{
+   const auto dir = GetJitCacheDir();
+   if (dir.empty())
+      return InterpreterCalc(code, context);
+
+   std::vector<void *> addresses;
+   const auto body = AbstractAddresses(code, addresses);
+
+   // The key covers everything the compiled code depends on: the code itself, everything it might refer to, the
+   // ROOT version and the command that compiles it (which contains the include paths).
+   const std::string keyContent = std::string(gROOT->GetVersion()) + '\n' + gROOT->GetGitCommit() + '\n' +
+                                  gSystem->GetMakeSharedLib() + '\n' + gSystem->GetIncludePath() + '\n' +
+                                  GetDeclaredCode() + '\n' + body;
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(keyContent.data()), keyContent.size());
+   md5.Final();
+   const std::string funcName = std::string("R_rdf_jit_") + md5.AsString();
+   const std::string basePath = dir + "/" + funcName;
+   const std::string library = basePath + "." + gSystem->GetSoExt();
+   const std::string failedMarker = basePath + ".failed";
+
+   if (gSystem->AccessPathName(library.c_str()) && gSystem->AccessPathName(failedMarker.c_str())) {
+      // Not in the cache yet: compile under a name unique to this process and move the library in place once it is
+      // complete, so that concurrent jobs never load a partially written file.
+      gSystem->mkdir(dir.c_str(), kTRUE);
+      const std::string tmpBase = basePath + "_" + std::to_string(gSystem->GetPid());
+      const std::string source = tmpBase + ".cxx";
+      {
+         std::ofstream out(source);
+         out << "// Generated by RDataFrame for its on-disk cache of jitted code, see RDataFrame.JitCacheDir\n"
+             << "#include \"ROOT/RDataFrame.hxx\"\n#include \"ROOT/RVec.hxx\"\n#include \"TMath.h\"\n\n"
+             << "namespace {\n" << GetDeclaredCode() << "}\n\n"
+             << "extern \"C\" void " << funcName << "(void **__rdf_addr)\n{\n(void)__rdf_addr;\n" << body << "\n}\n";
+      }
+      const std::string tmpLibrary = tmpBase + "." + gSystem->GetSoExt();
+      const std::string log = tmpBase + ".log";
+      TStopwatch s;
+      s.Start();
+      if (CompileJitLibrary(dir, gSystem->BaseName(library.c_str()), source, tmpLibrary, log)) {
+         gSystem->Rename(tmpLibrary.c_str(), library.c_str());
+         gSystem->Unlink(log.c_str());
+         s.Stop();
+         R__LOG_INFO(RDFLogChannel()) << "Stored the jitted code in " << library << " in " << s.RealTime()
+                                      << " seconds.";
+      } else {
+         // Typically the code refers to entities only known to the interpreter. Remember it, so that identical jobs
+         // do not try again.
+         std::ofstream(failedMarker) << "See " << log << " for the compiler output.\n";
+         gSystem->Unlink(tmpLibrary.c_str());
+         R__LOG_INFO(RDFLogChannel()) << "The jitted code could not be compiled into the cache, see " << log << '.';
+      }
+      gSystem->Unlink(source.c_str());
+   }
+
+   if (!gSystem->AccessPathName(library.c_str()) && gSystem->Load(library.c_str()) >= 0) {
+      if (auto func = reinterpret_cast<void (*)(void **)>(gSystem->DynFindSymbol(library.c_str(), funcName.c_str()))) {
+         R__LOG_INFO(RDFLogChannel()) << "Using the jitted code cached in " << library << '.';
+         func(addresses.data());
+         return 0;
+      }
+   }
+
+   return InterpreterCalc(code, context);
+}
+
 bool IsInternalColumn(std::string_view colName)
 {
    const auto str = colName.data();
@@ -36,6 +36,18 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+bool RJittedAction::CanRunBatch(unsigned int slot)
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->CanRunBatch(slot);
+}
+
+void RJittedAction::RunBatch(unsigned int slot, Long64_t firstEntry, std::size_t n)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->RunBatch(slot, firstEntry, n);
+}
+
 void RJittedAction::Initialize()
 {
    assert(fConcreteAction != nullptr);
@@ -47,6 +47,18 @@ void RJittedDefine::Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id)
    fConcreteDefine->Update(slot, id);
 }
 
+bool RJittedDefine::CanUpdateBatch(unsigned int slot)
+{
+   assert(fConcreteDefine != nullptr);
+   return fConcreteDefine->CanUpdateBatch(slot);
+}
+
+void *RJittedDefine::UpdateBatch(unsigned int slot, Long64_t firstEntry, std::size_t n, const char *mask)
+{
+   assert(fConcreteDefine != nullptr);
+   return fConcreteDefine->UpdateBatch(slot, firstEntry, n, mask);
+}
+
 void RJittedDefine::FinalizeSlot(unsigned int slot)
 {
    assert(fConcreteDefine != nullptr);
@@ -39,6 +39,18 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+bool RJittedFilter::CanCheckFiltersBatch(unsigned int slot)
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->CanCheckFiltersBatch(slot);
+}
+
+const char *RJittedFilter::CheckFiltersBatch(unsigned int slot, Long64_t firstEntry, std::size_t n)
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->CheckFiltersBatch(slot, firstEntry, n);
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    assert(fConcreteFilter != nullptr);
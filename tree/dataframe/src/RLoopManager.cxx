@@ -16,6 +16,7 @@
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RSlotStack.hxx"
+#include "ROOT/RDF/RTreeColumnReader.hxx" // RTreeBulkBranches
 #include "ROOT/RDF/RVariationBase.hxx"
 #include "ROOT/RLogger.hxx"
 #include "RtypesCore.h" // Long64_t
@@ -336,25 +337,27 @@ ColumnNames_t ROOT::Internal::RDF::GetBranchNames(TTree &t, bool allowDuplicates
    return bNames;
 }
 
+constexpr std::size_t RLoopManager::fgBatchSize;
+
 RLoopManager::RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches)
    : fTree(std::shared_ptr<TTree>(tree, [](TTree *) {})), fDefaultColumns(defaultBranches),
      fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
-     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots)
+     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fTreeBulkBranches(fNSlots)
 {
 }
 
 RLoopManager::RLoopManager(ULong64_t nEmptyEntries)
    : fNEmptyEntries(nEmptyEntries), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kNoFilesMT : ELoopType::kNoFiles), fNewSampleNotifier(fNSlots),
-     fSampleInfos(fNSlots)
+     fSampleInfos(fNSlots), fTreeBulkBranches(fNSlots)
 {
 }
 
 RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches)
    : fDefaultColumns(defaultBranches), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kDataSourceMT : ELoopType::kDataSource),
-     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots)
+     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fTreeBulkBranches(fNSlots)
 {
    fDataSource->SetNSlots(fNSlots);
 }
@@ -448,13 +451,25 @@ void RLoopManager::RunTreeProcessorMT()
       const auto entryRange = r.GetEntriesRange(); // we trust TTreeProcessorMT to call SetEntriesRange
       const auto nEntries = entryRange.second - entryRange.first;
       auto count = entryCount.fetch_add(nEntries);
+      // batches are not contiguous in the tree when reading through an entry list
+      const bool canRunBatches = r.GetEntryList() == nullptr;
+      bool runBatches = false;
       try {
          // recursive call to check filters and conditionally execute actions
          while (r.Next()) {
             if (fNewSampleNotifier.CheckFlag(slot)) {
                UpdateSampleInfo(slot, r);
+               runBatches = canRunBatches && CanRunBatches(slot);
+            }
+            if (runBatches) {
+               const auto n = GetBatchSize(r);
+               RunBatchAndCheckFilters(slot, count, n);
+               count += n;
+               // the next call to Next() loads the entry after the batch
+               r.SetEntry(r.GetCurrentEntry() + n - 1);
+            } else {
+               RunAndCheckFilters(slot, count++);
             }
-            RunAndCheckFilters(slot, count++);
          }
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -481,14 +496,28 @@ void RLoopManager::RunTreeReader()
    InitNodeSlots(&r, 0);
    R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing(TreeDatasetLogInfo(r, 0u));
 
+   // batches are not contiguous in the tree when reading through an entry list
+   const bool canRunBatches = r.GetEntryList() == nullptr;
+   bool runBatches = false;
+
    // recursive call to check filters and conditionally execute actions
    // in the non-MT case processing can be stopped early by ranges, hence the check on fNStopsReceived
+   // (graphs with ranges are never run in batches)
    try {
       while (r.Next() && fNStopsReceived < fNChildren) {
          if (fNewSampleNotifier.CheckFlag(0)) {
             UpdateSampleInfo(/*slot*/0, r);
+            runBatches = canRunBatches && CanRunBatches(0);
+         }
+         if (runBatches) {
+            const auto entry = r.GetCurrentEntry();
+            const auto n = GetBatchSize(r);
+            RunBatchAndCheckFilters(0, entry, n);
+            // the next call to Next() loads the entry after the batch
+            r.SetEntry(entry + n - 1);
+         } else {
+            RunAndCheckFilters(0, r.GetCurrentEntry());
          }
-         RunAndCheckFilters(0, r.GetCurrentEntry());
       }
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -578,12 +607,7 @@ void RLoopManager::RunDataSourceMT()
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
    // data-block callbacks run before the rest of the graph
-   if (fNewSampleNotifier.CheckFlag(slot)) {
-      for (auto &callback : fSampleCallbacks) {
-         callback(slot, fSampleInfos[slot]);
-      }
-      fNewSampleNotifier.UnsetFlag(slot);
-   }
+   RunSampleCallbacks(slot);
 
    for (auto &actionPtr : fBookedActions)
       actionPtr->Run(slot, entry);
@@ -593,11 +617,64 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// Whether all booked actions and named filters can process the entries of the current tree in batches.
+bool RLoopManager::CanRunBatches(unsigned int slot)
+{
+   for (auto &actionPtr : fBookedActions)
+      if (!actionPtr->CanRunBatch(slot))
+         return false;
+   for (auto &namedFilterPtr : fBookedNamedFilters)
+      if (!namedFilterPtr->CanCheckFiltersBatch(slot))
+         return false;
+   return true;
+}
+
+/// Return the size of the batch that starts at the current entry of the TTreeReader.
+/// Batches never cross tree boundaries nor the end of the reader's entry range.
+std::size_t RLoopManager::GetBatchSize(TTreeReader &r) const
+{
+   auto *tree = r.GetTree()->GetTree();
+   auto n = tree->GetEntries() - tree->GetReadEntry();
+   const auto rangeEnd = r.GetEntriesRange().second;
+   if (rangeEnd >= 0)
+      n = std::min(n, rangeEnd - r.GetCurrentEntry());
+   return std::min<std::size_t>(n, fgBatchSize);
+}
+
+/// Same as RunAndCheckFilters, for the entries [firstEntry, firstEntry + n).
+/// Every node is called once for the whole batch, and filters pass selection masks downstream.
+void RLoopManager::RunBatchAndCheckFilters(unsigned int slot, Long64_t firstEntry, std::size_t n)
+{
+   RunSampleCallbacks(slot);
+
+   for (auto &actionPtr : fBookedActions)
+      actionPtr->RunBatch(slot, firstEntry, n);
+   for (auto &namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->CheckFiltersBatch(slot, firstEntry, n);
+   for (auto &callback : fCallbacks) {
+      for (std::size_t i = 0; i < n; ++i)
+         callback(slot);
+   }
+}
+
+/// Run the data-block callbacks if a new data block started in the given slot.
+void RLoopManager::RunSampleCallbacks(unsigned int slot)
+{
+   if (fNewSampleNotifier.CheckFlag(slot)) {
+      for (auto &callback : fSampleCallbacks) {
+         callback(slot, fSampleInfos[slot]);
+      }
+      fNewSampleNotifier.UnsetFlag(slot);
+   }
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
+   if (r != nullptr)
+      fTreeBulkBranches[slot] = std::make_shared<RDFInternal::RTreeBulkBranches>();
    SetupSampleCallbacks(r, slot);
    for (auto &ptr : fBookedActions)
       ptr->InitSlot(r, slot);
@@ -700,6 +777,7 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
       ptr->FinalizeSlot(slot);
    for (auto &ptr : fBookedDefines)
       ptr->FinalizeSlot(slot);
+   fTreeBulkBranches[slot].reset();
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
@@ -717,7 +795,7 @@ void RLoopManager::Jit()
 
    TStopwatch s;
    s.Start();
-   RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   RDFInternal::InterpreterCalcCached(code, "RLoopManager::Run");
    s.Stop();
    R__LOG_INFO(RDFLogChannel()) << "Just-in-time compilation phase completed"
                                 << (s.RealTime() > 1e-3 ? " in " + std::to_string(s.RealTime()) + " seconds." : ".");
@@ -14,17 +14,26 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RDF/ActionHelpers.hxx>
 #include <ROOT/RDF/RColumnReaderBase.hxx>
+#include <ROOT/RError.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RFieldValue.hxx>
+#include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleDS.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <Compression.h>
 #include <TError.h>
+#include <TFile.h>
+#include <TString.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -73,11 +82,17 @@ public:
    // Field is only used for reading
    void GenerateColumnsImpl() final { assert(false && "Cardinality fields must only be used for reading"); }
 
-   void GenerateColumnsImpl(const RNTupleDescriptor &) final
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final
    {
-      RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
-         ROOT::Experimental::Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+      auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc);
+      RColumnModel model(type, true /* isSorted*/);
+      if (type == EColumnType::kIndex) {
+         fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
+            ROOT::Experimental::Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+      } else {
+         fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
+            ROOT::Experimental::Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(model, 0)));
+      }
       fPrincipalColumn = fColumns[0].get();
    }
 
@@ -307,6 +322,15 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
    if (fHasSeenAllRanges)
       return ranges;
 
+   if (fFilterFieldId != kInvalidDescriptorId) {
+      for (const auto &range :
+           fSources[0]->GetSharedDescriptorGuard()->FindEntryRanges(fFilterFieldId, fFilterMin, fFilterMax)) {
+         ranges.emplace_back(range.first, range.second);
+      }
+      fHasSeenAllRanges = true;
+      return ranges;
+   }
+
    auto nEntries = fSources[0]->GetNEntries();
    const auto chunkSize = nEntries / fNSlots;
    const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
@@ -323,6 +347,21 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
    return ranges;
 }
 
+void RNTupleDS::SetEntryRangeFilter(std::string_view fieldName, double min, double max)
+{
+   auto descriptorGuard = fSources[0]->GetSharedDescriptorGuard();
+   auto fieldId = descriptorGuard->FindFieldId(fieldName);
+   if (fieldId == kInvalidDescriptorId) {
+      throw RException(
+         R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '" + descriptorGuard->GetName() + "'"));
+   }
+   // Throws for fields that are not supported
+   descriptorGuard->FindEntryRanges(fieldId, min, max);
+   fFilterFieldId = fieldId;
+   fFilterMin = min;
+   fFilterMax = max;
+}
+
 std::string RNTupleDS::GetTypeName(std::string_view colName) const
 {
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), colName));
@@ -362,3 +401,165 @@ ROOT::RDataFrame ROOT::Experimental::MakeNTupleDataFrame(std::string_view ntuple
    ROOT::RDataFrame rdf(std::make_unique<RNTupleDS>(std::move(pageSource)));
    return rdf;
 }
+
+namespace {
+
+/// Writes the RNTuple of a Snapshot with one RNTupleFillContext per processing slot, so that the slots compress and
+/// commit their clusters concurrently
+class RNTupleSnapshotWriterImpl final : public ROOT::Internal::RDF::RNTupleSnapshotWriter {
+   struct RSlot {
+      std::unique_ptr<ROOT::Experimental::RNTupleFillContext> fContext;
+      /// Bare entry of fContext whose values point directly to the slot's column values
+      std::unique_ptr<ROOT::Experimental::REntry> fEntry;
+      /// The addresses of the column values that fEntry currently points to
+      std::vector<void *> fValueAddresses;
+   };
+
+   const std::vector<std::string> fFieldNames;
+   const Long64_t fAutoFlush;
+   std::unique_ptr<TFile> fOutputFile; // only used in "UPDATE" mode
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   std::vector<RSlot> fSlots;
+
+public:
+   RNTupleSnapshotWriterImpl(unsigned int nSlots, const std::string &fileName, const std::string &ntupleName,
+                             const std::vector<std::string> &fieldNames, const std::vector<std::string> &fieldTypes,
+                             const ROOT::RDF::RSnapshotOptions &options)
+      : fFieldNames(fieldNames), fAutoFlush(options.fAutoFlush), fSlots(nSlots)
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      for (std::size_t i = 0; i < fieldNames.size(); ++i) {
+         auto field = ROOT::Experimental::Detail::RFieldBase::Create(fieldNames[i], fieldTypes[i]);
+         if (!field) {
+            throw std::runtime_error("Snapshot: cannot write column '" + fieldNames[i] + "' of type '" +
+                                     fieldTypes[i] + "' to an RNTuple: " + field.GetError()->GetReport());
+         }
+         model->AddField(field.Unwrap());
+      }
+
+      ROOT::Experimental::RNTupleWriteOptions writeOptions;
+      writeOptions.SetCompression(
+         ROOT::CompressionSettings(options.fCompressionAlgorithm, options.fCompressionLevel));
+
+      TString mode = options.fMode;
+      mode.ToLower();
+      if (mode == "update") {
+         fOutputFile.reset(TFile::Open(fileName.c_str(), "UPDATE"));
+         if (!fOutputFile)
+            throw std::runtime_error("Snapshot: could not open output file " + fileName);
+         fWriter = ROOT::Experimental::RNTupleParallelWriter::Append(std::move(model), ntupleName, *fOutputFile,
+                                                                     writeOptions);
+      } else {
+         fWriter = ROOT::Experimental::RNTupleParallelWriter::Recreate(std::move(model), ntupleName, fileName,
+                                                                       writeOptions);
+      }
+
+      for (auto &slot : fSlots) {
+         slot.fContext = fWriter->CreateFillContext();
+         slot.fEntry = slot.fContext->GetModel()->CreateBareEntry();
+         slot.fValueAddresses.resize(fieldNames.size(), nullptr);
+      }
+   }
+
+   void Fill(unsigned int slot, void *const *values) final
+   {
+      auto &s = fSlots[slot];
+      // Values are usually at the same address for the entire task, so the entry rarely needs to be updated
+      for (std::size_t i = 0; i < fFieldNames.size(); ++i) {
+         if (s.fValueAddresses[i] != values[i]) {
+            s.fEntry->CaptureValueUnsafe(fFieldNames[i], values[i]);
+            s.fValueAddresses[i] = values[i];
+         }
+      }
+      s.fContext->Fill(*s.fEntry);
+      if ((fAutoFlush > 0) && (s.fContext->GetNEntries() % fAutoFlush == 0))
+         s.fContext->CommitCluster();
+   }
+
+   void Close() final
+   {
+      // The entries and fill contexts must not outlive the writer, which commits the footer on destruction
+      fSlots.clear();
+      fWriter.reset();
+      if (fOutputFile)
+         fOutputFile->Close();
+      fOutputFile.reset();
+   }
+
+   ULong64_t GetNEntries() const final
+   {
+      ULong64_t nEntries = 0;
+      for (const auto &slot : fSlots)
+         nEntries += slot.fContext->GetNEntries();
+      return nEntries;
+   }
+};
+
+/// The data source of the dataframe returned by an RNTuple Snapshot. The RNTuple is only written by the Snapshot event
+/// loop, so the underlying RNTupleDS is created on first use.
+class RDeferredNTupleDS final : public ROOT::RDF::RDataSource {
+   const std::string fNTupleName;
+   const std::string fFileName;
+   unsigned int fNSlots = 0;
+   mutable std::unique_ptr<ROOT::Experimental::RNTupleDS> fDataSource;
+
+   ROOT::Experimental::RNTupleDS &GetDataSource() const
+   {
+      if (!fDataSource) {
+         fDataSource = std::make_unique<ROOT::Experimental::RNTupleDS>(
+            ROOT::Experimental::Detail::RPageSource::Create(fNTupleName, fFileName));
+         if (fNSlots > 0)
+            fDataSource->SetNSlots(fNSlots);
+      }
+      return *fDataSource;
+   }
+
+public:
+   RDeferredNTupleDS(std::string_view ntupleName, std::string_view fileName)
+      : fNTupleName(ntupleName), fFileName(fileName)
+   {
+   }
+
+   void SetNSlots(unsigned int nSlots) final
+   {
+      fNSlots = nSlots;
+      if (fDataSource)
+         fDataSource->SetNSlots(nSlots);
+   }
+   const std::vector<std::string> &GetColumnNames() const final { return GetDataSource().GetColumnNames(); }
+   bool HasColumn(std::string_view colName) const final { return GetDataSource().HasColumn(colName); }
+   std::string GetTypeName(std::string_view colName) const final { return GetDataSource().GetTypeName(colName); }
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final { return GetDataSource().GetEntryRanges(); }
+   std::string GetLabel() final { return GetDataSource().GetLabel(); }
+   bool SetEntry(unsigned int slot, ULong64_t entry) final { return GetDataSource().SetEntry(slot, entry); }
+   void Initialize() final { GetDataSource().Initialize(); }
+   void Finalize() final { GetDataSource().Finalize(); }
+
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+   GetColumnReaders(unsigned int slot, std::string_view name, const std::type_info &ti) final
+   {
+      return GetDataSource().GetColumnReaders(slot, name, ti);
+   }
+
+protected:
+   Record_t GetColumnReadersImpl(std::string_view /* name */, const std::type_info & /* ti */) final { return {}; }
+};
+
+/// Provides the RNTuple output of RDataFrame's Snapshot, which is only available if this data source is built
+struct RRegisterSnapshotHooks {
+   RRegisterSnapshotHooks()
+   {
+      auto &hooks = ROOT::Internal::RDF::GetRNTupleSnapshotHooks();
+      hooks.fCreateWriter = [](unsigned int nSlots, const std::string &fileName, const std::string &ntupleName,
+                               const std::vector<std::string> &fieldNames, const std::vector<std::string> &fieldTypes,
+                               const ROOT::RDF::RSnapshotOptions &options) {
+         return std::make_unique<RNTupleSnapshotWriterImpl>(nSlots, fileName, ntupleName, fieldNames, fieldTypes,
+                                                            options);
+      };
+      hooks.fCreateDataSource = [](std::string_view ntupleName, std::string_view fileName) {
+         return std::make_unique<RDeferredNTupleDS>(ntupleName, fileName);
+      };
+   }
+} gRegisterSnapshotHooks;
+
+} // anonymous namespace
@@ -5,6 +5,7 @@
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/RTrivialDS.hxx"
+#include "TEnv.h"
 #include "TMemFile.h"
 #include "TSystem.h"
 #include "TTree.h"
@@ -840,3 +841,35 @@ TEST(RDataFrameInterface, FillCustomType)
    EXPECT_DOUBLE_EQ(res->GetMeanX(), 1.);
    EXPECT_DOUBLE_EQ(res->GetMeanY(), 2.);
 }
+
+TEST(RDataFrameInterface, JitCache)
+{
+   const std::string cacheDir = std::string(gSystem->TempDirectory()) + "/dataframe_interface_jitcache_" +
+                                std::to_string(gSystem->GetPid());
+   gEnv->SetValue("RDataFrame.JitCacheDir", cacheDir.c_str());
+
+   // Two identical computation graphs: the second one must reuse the library compiled for the first one.
+   auto run = [] {
+      return ROOT::RDataFrame(10)
+         .Define("x", "double(rdfentry_)")
+         .Filter("x > 4")
+         .Sum<double>("x")
+         .GetValue();
+   };
+   EXPECT_DOUBLE_EQ(run(), 35.);
+   EXPECT_DOUBLE_EQ(run(), 35.);
+
+   gEnv->SetValue("RDataFrame.JitCacheDir", "");
+   void *dir = gSystem->OpenDirectory(cacheDir.c_str());
+   ASSERT_NE(dir, nullptr);
+   int nLibraries = 0;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const TString name = entry;
+      if (name.EndsWith(TString(".") + gSystem->GetSoExt()))
+         ++nLibraries;
+      gSystem->Unlink((cacheDir + "/" + entry).c_str());
+   }
+   gSystem->FreeDirectory(dir);
+   gSystem->Unlink(cacheDir.c_str());
+   EXPECT_EQ(nLibraries, 1);
+}
@@ -14,6 +14,7 @@
 
 #include <algorithm> // std::sort
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <thread>
 #include <set>
@@ -978,6 +979,121 @@ TEST_P(RDFSimpleTests, FillWithCustomClassJitted)
    EXPECT_EQ(h.GetEntries(), 10);
 }
 
+// Fundamental-type branches are read one basket at a time, with a fallback to per-entry reading
+TEST_P(RDFSimpleTests, BulkReadFundamentalBranches)
+{
+   const auto treeName = "bulkread";
+   const std::vector<std::string> fileNames{"dataframe_simple_bulkread_0.root", "dataframe_simple_bulkread_1.root"};
+   const int nEntries = 1000;
+   for (const auto &fileName : fileNames) {
+      TFile f(fileName.c_str(), "RECREATE");
+      TTree t(treeName, treeName);
+      t.SetAutoFlush(300); // clusters span several baskets
+      float x;
+      int i;
+      bool b;
+      Long64_t l;
+      t.Branch("x", &x)->SetBasketSize(64);
+      t.Branch("i", &i)->SetBasketSize(128);
+      t.Branch("b", &b);
+      t.Branch("l", &l);
+      for (i = 0; i < nEntries; ++i) {
+         x = i * 0.5f;
+         b = i % 3 == 0;
+         l = -i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TChain c(treeName);
+   for (const auto &fileName : fileNames)
+      c.Add(fileName.c_str());
+   RDataFrame df(c);
+   auto sumx = df.Sum<float>("x");
+   auto sumi = df.Sum<int>("i");
+   auto nb = df.Filter([](bool b) { return b; }, {"b"}).Count();
+   auto suml = df.Sum<Long64_t>("l");
+   // the same branch read through the bulk reader and through a TTreeReaderValue-backed reader
+   auto consistent = df.Filter([](float x, int i) { return x == i * 0.5f; }, {"x", "i"}).Count();
+
+   const double expectedSum = nEntries * (nEntries - 1) / 2.;
+   EXPECT_DOUBLE_EQ(*sumx, 2 * 0.5 * expectedSum);
+   EXPECT_DOUBLE_EQ(*sumi, 2 * expectedSum);
+   EXPECT_EQ(*nb, 2u * ((nEntries + 2) / 3));
+   EXPECT_DOUBLE_EQ(*suml, -2 * expectedSum);
+   EXPECT_EQ(*consistent, 2u * nEntries);
+
+   if (!GetParam()) {
+      // ranges start in the middle of a basket, and the entries are not processed in batches
+      auto rangeSum = df.Range(17, 1500).Sum<int>("i");
+      double expectedRangeSum = 0.;
+      for (int e = 17; e < 1500; ++e)
+         expectedRangeSum += e % nEntries;
+      EXPECT_DOUBLE_EQ(*rangeSum, expectedRangeSum);
+   }
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}
+
+TEST_P(RDFSimpleTests, BatchedDefinesAndFilters)
+{
+   const auto treeName = "batches";
+   const auto fileName = "dataframe_simple_batches.root";
+   const int nEntries = 5000;
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t(treeName, treeName);
+      t.SetAutoFlush(700);
+      double x;
+      int i;
+      t.Branch("x", &x)->SetBasketSize(256);
+      t.Branch("i", &i);
+      for (i = 0; i < nEntries; ++i) {
+         x = i * 0.25;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   RDataFrame df(treeName, fileName);
+   // defines are evaluated lazily, only for the entries selected by the filters upstream of their readers
+   std::atomic<int> nEvaluated{0};
+   auto dfd = df.Define("y",
+                        [&nEvaluated](double x, int i) {
+                           ++nEvaluated;
+                           return x * 4 - i;
+                        },
+                        {"x", "i"})
+                 .DefineSlotEntry("entry", [](unsigned int, ULong64_t e) { return e; });
+   auto even = df.Filter([](int i) { return i % 2 == 0; }, {"i"}, "even");
+   auto evenWithY = dfd.Filter([](int i) { return i % 2 == 0; }, {"i"}, "evenWithY");
+   auto sumY = evenWithY.Sum<double>("y");
+   auto sumX = even.Filter([](double x) { return x < 100.; }, {"x"}).Sum<double>("x");
+   auto nEven = even.Count();
+   auto maxEntry = dfd.Max<ULong64_t>("entry");
+   auto h = evenWithY.Histo1D<double>({"h", "h", 10, 0., 10.}, "y");
+   auto report = df.Report();
+
+   EXPECT_DOUBLE_EQ(*sumY, 0.);
+   EXPECT_EQ(*nEven, nEntries / 2u);
+   double expectedSumX = 0.;
+   for (int i = 0; i < 400; i += 2)
+      expectedSumX += i * 0.25;
+   EXPECT_DOUBLE_EQ(*sumX, expectedSumX);
+   EXPECT_EQ(*maxEntry, nEntries - 1u);
+   EXPECT_EQ(h->GetEntries(), nEntries / 2.);
+   EXPECT_EQ(h->GetBinContent(1), nEntries / 2.);
+   EXPECT_EQ(nEvaluated.load(), nEntries / 2);
+   const auto &evenInfo = report->At("evenWithY");
+   EXPECT_EQ(evenInfo.GetAll(), ULong64_t(nEntries));
+   EXPECT_EQ(evenInfo.GetPass(), nEntries / 2u);
+   EXPECT_EQ(even.Report()->At("even").GetPass(), nEntries / 2u);
+
+   gSystem->Unlink(fileName);
+}
+
 // run single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFSimpleTests, ::testing::Values(false));
 
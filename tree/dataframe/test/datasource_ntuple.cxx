@@ -125,3 +125,49 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+void SnapshotTest(const std::string &fname)
+{
+   auto df = ROOT::RDataFrame(100)
+                .Define("i", [](ULong64_t e) { return static_cast<int>(e); }, {"rdfentry_"})
+                .Define("l", [](ULong64_t e) { return static_cast<Long64_t>(e) - 50; }, {"rdfentry_"})
+                .Define("v", [](int i) { return ROOT::RVec<float>(i % 3, i); }, {"i"});
+
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   opts.fAutoFlush = 10;
+   auto snap = df.Snapshot<int, Long64_t, ROOT::RVec<float>>("ntuple", fname, {"i", "l", "v"}, opts);
+
+   auto ntuple = ROOT::Experimental::RNTupleReader::Open("ntuple", fname);
+   EXPECT_EQ(100u, ntuple->GetNEntries());
+   // Every processing slot commits a cluster after 10 of its own entries
+   EXPECT_LE(10u, ntuple->GetDescriptor()->GetNClusters());
+   EXPECT_STREQ("std::int32_t", ntuple->GetModel()->GetField("i")->GetType().c_str());
+   EXPECT_STREQ("std::int64_t", ntuple->GetModel()->GetField("l")->GetType().c_str());
+
+   // The returned dataframe reads the RNTuple; entries may be shuffled in multi-thread runs
+   auto sumI = snap->Sum<std::int32_t>("i");
+   auto sumL = snap->Sum<std::int64_t>("l");
+   auto nV = snap->Define("nv", [](const std::vector<float> &v) { return v.size(); }, {"v"}).Sum<std::size_t>("nv");
+   auto consistent = snap->Filter([](std::int32_t i, std::int64_t l) { return l == i - 50; }, {"i", "l"}).Count();
+   EXPECT_EQ(4950, *sumI);
+   EXPECT_EQ(-50, *sumL);
+   EXPECT_EQ(99u, *nV);
+   EXPECT_EQ(100u, *consistent);
+}
+
+TEST(RNTupleSnapshot, Basics)
+{
+   std::string fname = "RNTupleDS_snapshot.root";
+   SnapshotTest(fname);
+   std::remove(fname.c_str());
+}
+
+TEST(RNTupleSnapshot, BasicsMT)
+{
+   IMTRAII _;
+
+   std::string fname = "RNTupleDS_snapshot_mt.root";
+   SnapshotTest(fname);
+   std::remove(fname.c_str());
+}
@@ -50,6 +50,14 @@ enum class EColumnType {
    kInt32,
    kInt16,
    kInt8,
+   // Split encodings: the bytes of the elements of a page are stored byte by byte, i.e. all the first bytes,
+   // then all the second bytes etc.  Index columns are additionally delta encoded, integer columns zigzag encoded.
+   kSplitIndex32,
+   kSplitReal64,
+   kSplitReal32,
+   kSplitInt64,
+   kSplitInt32,
+   kSplitInt16,
    kMax,
 };
 
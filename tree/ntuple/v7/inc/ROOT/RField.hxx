@@ -101,6 +101,10 @@ protected:
    RColumn* fPrincipalColumn;
    /// The columns are connected either to a sink or to a source (not to both); they are owned by the field.
    std::vector<std::unique_ptr<RColumn>> fColumns;
+   /// Whether the field's columns use the split encoded column types (where available for the column type).
+   /// Set from the write options when connecting to a page sink and from the on-disk column types when connecting
+   /// to a page source.
+   bool fUseSplitEncoding = false;
 
    /// Creates the backing columns corresponsing to the field type for writing
    virtual void GenerateColumnsImpl() = 0;
@@ -233,6 +237,8 @@ public:
    void Attach(std::unique_ptr<Detail::RFieldBase> child);
 
    std::string GetName() const { return fName; }
+   /// Returns the field name and parent field names separated by dots ("grandparent.parent.child")
+   std::string GetQualifiedFieldName() const;
    std::string GetType() const { return fType; }
    ENTupleStructure GetStructure() const { return fStructure; }
    std::size_t GetNRepetitions() const { return fNRepetitions; }
@@ -1421,12 +1427,20 @@ public:
    ~RField() = default;
 
    void GenerateColumnsImpl() final {
-      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+      if (fUseSplitEncoding) {
+         RColumnModel modelIndex(EColumnType::kSplitIndex32, true /* isSorted*/);
+         fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+            Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(modelIndex, 0)));
+      } else {
+         RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+         fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+            Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+      }
    }
    // TODO(jblomer): update together with RVec 2.0
-   void GenerateColumnsImpl(const RNTupleDescriptor & /*desc*/) final {
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final {
+      auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc);
+      fUseSplitEncoding = (type == EColumnType::kSplitIndex32);
       GenerateColumnsImpl();
    }
    void DestroyValue(const Detail::RFieldValue& value, bool dtorOnly = false) final {
@@ -1506,12 +1520,20 @@ public:
    ~RField() = default;
 
    void GenerateColumnsImpl() final {
-      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+      if (fUseSplitEncoding) {
+         RColumnModel modelIndex(EColumnType::kSplitIndex32, true /* isSorted*/);
+         fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+            Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(modelIndex, 0)));
+      } else {
+         RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+         fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+            Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+      }
    }
    // TODO(jblomer): update together with RVec 2.0
-   void GenerateColumnsImpl(const RNTupleDescriptor & /*desc*/) final {
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final {
+      auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc);
+      fUseSplitEncoding = (type == EColumnType::kSplitIndex32);
       GenerateColumnsImpl();
    }
    void DestroyValue(const Detail::RFieldValue& value, bool dtorOnly = false) final {
@@ -29,8 +29,10 @@
 
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -276,6 +278,24 @@ public:
    /// ~~~
    RNTupleGlobalRange GetEntryRange() { return RNTupleGlobalRange(0, GetNEntries()); }
 
+   /// Returns the entry ranges that may contain values of the given top-level arithmetic field in [min, max].  Entries
+   /// outside the returned ranges are guaranteed not to match, entries inside may or may not match.  The selection is
+   /// based on the value ranges of clusters and pages, which are only written with
+   /// RNTupleWriteOptions::SetUseValueRanges().  Without them, the returned ranges cover all entries.
+   ///
+   /// **Example: only read the pages that can contain a "pt" value larger than 10**
+   /// ~~~ {.cpp}
+   /// auto ntuple = RNTupleReader::Open("myNTuple", "some/file.root");
+   /// auto pt = ntuple->GetView<float>("pt");
+   /// for (auto range : ntuple->GetEntryRanges("pt", 10, std::numeric_limits<double>::infinity())) {
+   ///    for (auto i : range) {
+   ///       if (pt(i) > 10)
+   ///          std::cout << i << ": " << pt(i) << "\n";
+   ///    }
+   /// }
+   /// ~~~
+   std::vector<RNTupleGlobalRange> GetEntryRanges(std::string_view fieldName, double min, double max);
+
    /// Provides access to an individual field that can contain either a scalar value or a collection, e.g.
    /// GetView<double>("particles.pt") or GetView<std::vector<double>>("particle").  It can as well be the index
    /// field of a collection itself, like GetView<NTupleSize_t>("particle").
@@ -344,42 +364,101 @@ public:
    const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
 };
 
+class RNTupleParallelWriter;
+
 // clang-format off
 /**
-\class ROOT::Experimental::RNTupleWriter
+\class ROOT::Experimental::RNTupleFillContext
 \ingroup NTuple
-\brief An RNTuple that gets filled with entries (data) and writes them to storage
-
-An output ntuple can be filled with entries. The caller has to make sure that the data that gets filled into an ntuple
-is not modified for the time of the Fill() call. The fill call serializes the C++ object into the column format and
-writes data into the corresponding column page buffers.  Writing of the buffers to storage is deferred and can be
-triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception is thrown.
+\brief A per-thread context to fill entries into an RNTupleParallelWriter
+
+A fill context owns a copy of the writer's model and builds its own clusters.  The pages of a cluster are compressed
+in the filling thread as they are committed by the columns.  When the cluster is complete, its sealed pages are written
+in one go into the writer's page sink; this is the only step that is serialized among the fill contexts.  Entries of
+one cluster thus stay together but the order of the clusters of different contexts in the file is unspecified.
+A fill context must not be used by more than one thread at a time and it must be destructed before its writer.
+An RNTupleWriter fills its entries through a fill context, too, which directly uses the writer's page sink.
 */
 // clang-format on
-class RNTupleWriter {
+class RNTupleFillContext {
+   friend class RNTupleWriter;
+   friend class RNTupleParallelWriter;
+
 private:
-   /// The page sink's parallel page compression scheduler if IMT is on.
-   /// Needs to be destructed after the page sink is destructed and so declared before.
-   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fZipTasks;
+   /// Collects the sealed pages of the open cluster and hands them over to the parallel writer, or the page sink of
+   /// an RNTupleWriter
    std::unique_ptr<Detail::RPageSink> fSink;
    /// Needs to be destructed before fSink
    std::unique_ptr<RNTupleModel> fModel;
-   Detail::RNTupleMetrics fMetrics;
    NTupleSize_t fLastCommitted = 0;
-   NTupleSize_t fLastCommittedClusterGroup = 0;
    NTupleSize_t fNEntries = 0;
    /// Keeps track of the number of bytes written into the current cluster
    std::size_t fUnzippedClusterSize = 0;
-   /// The total number of bytes written to storage (i.e., after compression)
+   /// The total number of bytes written to storage (i.e., after compression) by this context
    std::uint64_t fNBytesCommitted = 0;
-   /// The total number of bytes filled into all the so far committed clusters,
-   /// i.e. the uncompressed size of the written clusters
+   /// The total number of bytes filled into all the clusters committed so far by this context
    std::uint64_t fNBytesFilled = 0;
    /// Limit for committing cluster no matter the other tunables
    std::size_t fMaxUnzippedClusterSize;
    /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
    NTupleSize_t fUnzippedClusterSizeEst;
 
+   /// Throws an exception if the model or the sink is null.  The owner of the context creates the sink for the
+   /// frozen model, after setting up the sink's task scheduler.
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext &) = delete;
+   RNTupleFillContext &operator=(const RNTupleFillContext &) = delete;
+   ~RNTupleFillContext();
+
+   /// Fill the default entry of the context's model
+   void Fill() { Fill(*fModel->GetDefaultEntry()); }
+   /// The entry must have been created by this fill context
+   void Fill(REntry &entry)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
+         throw RException(R__FAIL("mismatch between entry and model"));
+
+      for (auto &value : entry) {
+         fUnzippedClusterSize += value.GetField()->Append(value);
+      }
+      fNEntries++;
+      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
+         CommitCluster();
+   }
+   /// Compress the entries filled since the last cluster and write them as a new cluster to the writer's sink
+   void CommitCluster();
+
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+   /// Returns the context's copy of the writer's model
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+   /// Returns the number of entries filled into this context
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleWriter
+\ingroup NTuple
+\brief An RNTuple that gets filled with entries (data) and writes them to storage
+
+An output ntuple can be filled with entries. The caller has to make sure that the data that gets filled into an ntuple
+is not modified for the time of the Fill() call. The fill call serializes the C++ object into the column format and
+writes data into the corresponding column page buffers.  Writing of the buffers to storage is deferred and can be
+triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception is thrown.
+*/
+// clang-format on
+class RNTupleWriter {
+private:
+   /// The page sink's parallel page compression scheduler if IMT is on.
+   /// Needs to be destructed after the page sink is destructed and so declared before.
+   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fZipTasks;
+   /// Fills the entries and commits the clusters into the writer's page sink
+   RNTupleFillContext fFillContext;
+   Detail::RNTupleMetrics fMetrics;
+   NTupleSize_t fLastCommittedClusterGroup = 0;
+
    // Helper function that is called from CommitCluster() when necessary
    void CommitClusterGroup();
 
@@ -401,24 +480,77 @@ public:
    ~RNTupleWriter();
 
    /// The simplest user interface if the default entry that comes with the ntuple model is used
-   void Fill() { Fill(*fModel->GetDefaultEntry()); }
+   void Fill() { fFillContext.Fill(); }
    /// Multiple entries can have been instantiated from the ntuple model.  This method will perform
    /// a light check whether the entry comes from the ntuple's own model
-   void Fill(REntry &entry) {
-      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
-         throw RException(R__FAIL("mismatch between entry and model"));
-
-      for (auto& value : entry) {
-         fUnzippedClusterSize += value.GetField()->Append(value);
-      }
-      fNEntries++;
-      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
-         CommitCluster();
-   }
+   void Fill(REntry &entry) { fFillContext.Fill(entry); }
    /// Ensure that the data from the so far seen Fill calls has been written to storage
    void CommitCluster(bool commitClusterGroup = false);
 
-   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+   std::unique_ptr<REntry> CreateEntry() { return fFillContext.CreateEntry(); }
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+
+   const RNTupleModel *GetModel() const { return fFillContext.GetModel(); }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple that is filled concurrently by several threads, each one through its own RNTupleFillContext
+
+The parallel writer owns the page sink and the model.  Every producer thread asks for a fill context with
+CreateFillContext() and fills entries into it; there is no need to write one file per thread and merge them afterwards.
+For instance
+~~~ {.cpp}
+auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", "data.root");
+// in each thread
+auto context = writer->CreateFillContext();
+auto entry = context->CreateEntry();
+for (...) {
+   // set the values of entry
+   context->Fill(*entry);
+}
+~~~
+The ntuple is finalized when the writer is destructed, which must happen after all of its fill contexts are destructed.
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   class RFillContextSink;
+
+   /// Serializes the cluster commits of the fill contexts
+   std::mutex fMutex;
+   /// The unbuffered sink that receives the sealed pages of all the fill contexts
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// The model used to create the sink.  Needs to be destructed before fSink.
+   std::unique_ptr<RNTupleModel> fModel;
+   /// Unfrozen copy of the model from which the models of the fill contexts are cloned
+   std::unique_ptr<RNTupleModel> fPrototypeModel;
+   Detail::RNTupleMetrics fMetrics;
+   /// The number of entries in the clusters committed so far by all the fill contexts, protected by fMutex
+   NTupleSize_t fNEntries = 0;
+
+public:
+   /// Throws an exception if the model is null or frozen.
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName, std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model is null or frozen.
+   static std::unique_ptr<RNTupleParallelWriter> Append(std::unique_ptr<RNTupleModel> model,
+                                                        std::string_view ntupleName, TFile &file,
+                                                        const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model or the sink is null or if the model is frozen.  Each fill context requires
+   /// its own model id, which is only assigned on freezing the context's copy of the model.
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter &) = delete;
+   RNTupleParallelWriter &operator=(const RNTupleParallelWriter &) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Creates a new fill context with its own copy of the model.  Thread-safe.
+   std::unique_ptr<RNTupleFillContext> CreateFillContext();
 
    void EnableMetrics() { fMetrics.Enable(); }
    const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
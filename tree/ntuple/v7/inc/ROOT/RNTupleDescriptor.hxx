@@ -34,6 +34,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -194,6 +195,23 @@ class RClusterDescriptor {
    friend class RClusterDescriptorBuilder;
 
 public:
+   /// The minimum and maximum value of the elements of a page or of a column in a cluster.  Value ranges are only
+   /// recorded for the columns of fields of arithmetic type.  Integers are converted to double such that the
+   /// range still contains all the values.  NaN values are ignored.
+   struct RValueRange {
+      double fMin = 0;
+      double fMax = 0;
+      /// False if no value range was recorded
+      bool fIsValid = false;
+
+      bool operator==(const RValueRange &other) const {
+         return fIsValid == other.fIsValid && (!fIsValid || (fMin == other.fMin && fMax == other.fMax));
+      }
+
+      /// Returns true unless the value range is known and does not intersect [min, max]
+      bool MayIntersect(double min, double max) const { return !fIsValid || (fMin <= max && fMax >= min); }
+   };
+
    /// The window of element indexes of a particular column in a particular cluster
    struct RColumnRange {
       DescriptorId_t fColumnId = kInvalidDescriptorId;
@@ -204,13 +222,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The union of the value ranges of the pages; only valid if all the pages have a value range
+      RValueRange fValueRange;
 
       bool operator==(const RColumnRange &other) const {
          return fColumnId == other.fColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fValueRange == other.fValueRange;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -227,9 +245,11 @@ public:
          ClusterSize_t fNElements = kInvalidClusterIndex;
          /// The meaning of fLocator depends on the storage backend.
          RNTupleLocator fLocator;
+         /// Optional statistics of the values stored in the page
+         RValueRange fValueRange;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fValueRange == other.fValueRange;
          }
       };
       struct RPageInfoExtended : RPageInfo {
@@ -706,6 +726,11 @@ public:
    DescriptorId_t FindClusterId(DescriptorId_t columnId, NTupleSize_t index) const;
    DescriptorId_t FindNextClusterId(DescriptorId_t clusterId) const;
    DescriptorId_t FindPrevClusterId(DescriptorId_t clusterId) const;
+   /// Returns the sorted, non-overlapping entry ranges [first, end) that may contain values of the given field in
+   /// [min, max], as far as can be told from the value ranges of the clusters and pages.  Entry ranges without value
+   /// range information are always included.  The field must be a top-level field of arithmetic type.
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>>
+   FindEntryRanges(DescriptorId_t fieldId, double min, double max) const;
 
    /// Walks up the parents of the field ID and returns a field name of the form a.b.c.d
    /// In case of invalid field ID, an empty string is returned.
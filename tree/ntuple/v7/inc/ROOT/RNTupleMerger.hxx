@@ -19,6 +19,8 @@
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RSpan.hxx>
 
 namespace ROOT {
 namespace Experimental {
@@ -38,6 +40,30 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates the entries of several ntuples with the same schema into a new ntuple
+
+The merger works on the page level: the sealed (packed and compressed) pages of the sources are copied byte-for-byte
+into the destination.  Only the page locations and the cluster, header, and footer meta-data are written anew.
+Pages are decompressed and compressed again only if the compression settings of a source column differ from the
+ones of the destination.  The clusters of the sources are appended to the destination in the order of the sources.
+For incremental merging, one of the sources can be stored in the same container as the destination: its pages are
+then referenced by the destination as they are, unless they must be compressed again.
+*/
+// clang-format on
+class RNTupleMerger {
+public:
+   /// Merges the sources into the destination.  The sources must be attached, the destination must not have been
+   /// created yet; it is created from the model of the first source and committed at the end.
+   /// Throws an exception if there are no sources or if the fields and columns of a source differ from the ones
+   /// of the first source.  If given, inPlaceSource is the source stored in the container of the destination.
+   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination,
+              const Detail::RPageSource *inPlaceSource = nullptr);
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -20,6 +20,8 @@
 #include <ROOT/RNTupleUtil.hxx>
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 namespace ROOT {
 namespace Experimental {
@@ -60,6 +62,24 @@ class RNTupleWriteOptions {
    /// fApproxUnzippedPageSize/2 and fApproxUnzippedPageSize * 1.5 in size.
    std::size_t fApproxUnzippedPageSize = 64 * 1024;
    bool fUseBufferedWrite = true;
+   /// Number of threads that the buffered page sink uses to compress pages in parallel if implicit
+   /// multi-threading is off.  Zero means that pages are compressed sequentially when the cluster is committed.
+   unsigned int fZipThreads = 0;
+   /// If set, the buffered page sink writes a committed cluster in a background thread while the next cluster
+   /// is filled.  At most one cluster is written in the background at any time.
+   bool fUseAsyncClusterWrite = false;
+   /// Upper limit on the memory used by the buffered page sink for pages that are not yet written.  If exceeded,
+   /// the pages buffered so far are written before the cluster is committed.  Zero means no limit.
+   std::size_t fPageBufferBudget = 0;
+   /// Whether fields should use the split encoded column types: the bytes of the elements of a page are grouped
+   /// by significance, index columns are additionally delta encoded and integer columns zigzag encoded.
+   /// Usually improves the compression ratio of floating point and integer data.
+   bool fUseSplitEncoding = false;
+   /// Per-field settings that take precedence over fUseSplitEncoding, keyed by the qualified field name
+   std::unordered_map<std::string, bool> fFieldSplitEncoding;
+   /// If set, the page sink records the minimum and maximum value of every page of the columns of arithmetic fields.
+   /// Readers can use these value ranges to skip clusters and pages, see RNTupleReader::GetEntryRanges().
+   bool fUseValueRanges = false;
 
 public:
    virtual ~RNTupleWriteOptions() = default;
@@ -85,6 +105,27 @@ public:
 
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
+
+   unsigned int GetZipThreads() const { return fZipThreads; }
+   void SetZipThreads(unsigned int val) { fZipThreads = val; }
+
+   bool GetUseAsyncClusterWrite() const { return fUseAsyncClusterWrite; }
+   void SetUseAsyncClusterWrite(bool val) { fUseAsyncClusterWrite = val; }
+
+   std::size_t GetPageBufferBudget() const { return fPageBufferBudget; }
+   void SetPageBufferBudget(std::size_t val) { fPageBufferBudget = val; }
+
+   bool GetUseSplitEncoding() const { return fUseSplitEncoding; }
+   void SetUseSplitEncoding(bool val) { fUseSplitEncoding = val; }
+   /// Whether the field with the given qualified name (e.g. "jets.pt") uses split encoded column types
+   bool GetUseSplitEncoding(const std::string &qualifiedFieldName) const;
+   void SetUseSplitEncoding(const std::string &qualifiedFieldName, bool val)
+   {
+      fFieldSplitEncoding[qualifiedFieldName] = val;
+   }
+
+   bool GetUseValueRanges() const { return fUseValueRanges; }
+   void SetUseValueRanges(bool val) { fUseValueRanges = val; }
 };
 
 // clang-format off
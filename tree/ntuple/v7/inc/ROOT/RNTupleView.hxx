@@ -20,6 +20,7 @@
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -145,7 +146,9 @@ The view owns a field and its underlying columns in order to fill an ntuple valu
 accessed by index. For top-level fields, the index refers to the entry number. Fields that are part of
 nested collections have global index numbers that are derived from their parent indexes.
 
-Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+Fields of simple types with a Map() method will use that and thus expose zero-copy access.  For such fields, MapV()
+gives direct access to the page memory and ReadBulk() copies an entry range page by page into a caller-provided
+buffer.
 */
 // clang-format on
 template <typename T>
@@ -160,6 +163,27 @@ private:
    /// Used as a Read() destination for fields that are not mappable
    Detail::RFieldValue fValue;
 
+   void ReadBulkImpl(NTupleSize_t firstIndex, NTupleSize_t count, T *buffer, std::true_type /* isMappable */)
+   {
+      while (count > 0) {
+         NTupleSize_t nPageItems = 0;
+         const T *pageBuffer = fField.MapV(firstIndex, nPageItems);
+         const auto nItems = std::min(count, nPageItems);
+         std::copy(pageBuffer, pageBuffer + nItems, buffer);
+         firstIndex += nItems;
+         buffer += nItems;
+         count -= nItems;
+      }
+   }
+
+   void ReadBulkImpl(NTupleSize_t firstIndex, NTupleSize_t count, T *buffer, std::false_type /* isMappable */)
+   {
+      for (NTupleSize_t i = 0; i < count; ++i) {
+         fField.Read(firstIndex + i, &fValue);
+         buffer[i] = std::move(*fValue.Get<T>());
+      }
+   }
+
 public:
    RNTupleView(DescriptorId_t fieldId, Detail::RPageSource *pageSource)
       : fField(pageSource->GetSharedDescriptorGuard()->GetFieldDescriptor(fieldId).GetFieldName()),
@@ -216,6 +240,15 @@ public:
    MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
       return fField.MapV(clusterIndex, nItems);
    }
+
+   /// Fills buffer[0..count) with the values at the global indexes [firstIndex, firstIndex + count).  The range can
+   /// span several pages and clusters.  Mappable fields are copied page by page from the page memory; other fields
+   /// are read value by value.  For a collection field, the values of its items can be read in bulk from the view of
+   /// the item field, using the item ranges from RNTupleViewCollection::ReadOffsetsBulk().
+   void ReadBulk(NTupleSize_t firstIndex, NTupleSize_t count, T *buffer)
+   {
+      ReadBulkImpl(firstIndex, count, buffer, std::integral_constant<bool, Internal::IsMappable<FieldT>::value>());
+   }
 };
 
 
@@ -232,6 +265,16 @@ class RNTupleViewCollection : public RNTupleView<ClusterSize_t> {
 private:
    Detail::RPageSource* fSource;
    DescriptorId_t fCollectionFieldId;
+   /// A column with one element per collection item; used to translate cluster-local item indexes into global ones
+   DescriptorId_t fItemColumnId = kInvalidDescriptorId;
+   /// The number of elements of fItemColumnId per collection item, larger than one for arrays of fixed size
+   std::uint64_t fNElementsPerItem = 1;
+   /// The cluster of the last translated item index and the global index of its first item
+   DescriptorId_t fItemClusterId = kInvalidDescriptorId;
+   NTupleSize_t fItemClusterOffset = 0;
+
+   /// Returns the global index of the given item of the collection
+   NTupleSize_t GetGlobalItemIndex(const RClusterIndex &clusterIndex);
 
    RNTupleViewCollection(DescriptorId_t fieldId, Detail::RPageSource* source)
       : RNTupleView<ClusterSize_t>(fieldId, source)
@@ -281,6 +324,11 @@ public:
       return RNTupleViewCollection(fieldId, fSource);
    }
 
+   /// Fills offsets[0..count] such that the items of the collection at the global index firstIndex + i have the
+   /// global item indexes [offsets[i], offsets[i + 1]).  Together with RNTupleView::ReadBulk() on the views of the
+   /// item fields, this reads the collections of an entry range into flat buffers.  Nothing is written for count == 0.
+   void ReadOffsetsBulk(NTupleSize_t firstIndex, NTupleSize_t count, NTupleSize_t *offsets);
+
    ClusterSize_t operator()(NTupleSize_t globalIndex) {
       ClusterSize_t size;
       RClusterIndex collectionStart;
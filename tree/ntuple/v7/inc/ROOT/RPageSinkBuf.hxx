@@ -20,9 +20,20 @@
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RPageStorage.hxx>
 
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
 #include <deque>
+#include <exception>
+#include <functional>
+#include <future>
 #include <iterator>
 #include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -34,6 +45,12 @@ namespace Detail {
 \ingroup NTuple
 \brief Wrapper sink that coalesces cluster column page writes
 *
+* Pages are compressed as soon as they are committed if a task scheduler is set (implicit multi-threading)
+* or if the write options request a number of zip threads, in which case the sink runs its own thread pool.
+* With asynchronous cluster writes, a committed cluster is written to the inner sink by a background thread
+* while the next cluster is filled and compressed.  The memory used by the buffered pages can be bounded by
+* the page buffer budget of the write options: when exceeded, the pages of the open cluster are flushed early.
+*
 * TODO(jblomer): The interplay of derived class and RPageSink is not yet optimally designed for page storage wrapper
 * classes like this one. Header and footer serialization, e.g., are done twice.  To be revised.
 */
@@ -95,10 +112,47 @@ private:
       std::deque<RPageZipItem> fBufferedPages;
    };
 
+   /// Task scheduler for parallel page compression that is used if the sink was not given a scheduler, e.g.
+   /// because implicit multi-threading is off.  Runs a fixed number of std::threads that take compression
+   /// tasks from a shared queue.
+   class RZipThreadPool : public RTaskScheduler {
+   private:
+      std::vector<std::thread> fThreads;
+      /// Protects the task queue and the bookkeeping of unfinished tasks
+      std::mutex fLock;
+      /// Signals a non-empty task queue or the termination of the pool
+      std::condition_variable fCvHasWork;
+      /// Signals that all added tasks are finished
+      std::condition_variable fCvAllDone;
+      std::queue<std::function<void(void)>> fTasks;
+      /// Number of queued and running tasks
+      std::size_t fNUnfinished = 0;
+      bool fIsTerminating = false;
+      /// The first exception thrown by a task, rethrown by Wait()
+      std::exception_ptr fException;
+
+      /// The worker thread routine
+      void ExecTasks();
+
+   public:
+      explicit RZipThreadPool(unsigned int nThreads);
+      RZipThreadPool(const RZipThreadPool &) = delete;
+      RZipThreadPool &operator=(const RZipThreadPool &) = delete;
+      ~RZipThreadPool();
+
+      void Reset() final {}
+      void AddTask(const std::function<void(void)> &taskFunc) final;
+      void Wait() final;
+   };
+
 private:
    /// I/O performance counters that get registered in fMetrics
    struct RCounters {
       RNTuplePlainCounter &fParallelZip;
+      RNTuplePlainCounter &fAsyncClusterWrite;
+      RNTupleAtomicCounter &fNFlushBudget;
+      RNTupleAtomicCounter &fTimeWallWaitWrite;
+      RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuWaitWrite;
    };
    std::unique_ptr<RCounters> fCounters;
    RNTupleMetrics fMetrics;
@@ -109,6 +163,32 @@ private:
    std::unique_ptr<RNTupleModel> fInnerModel;
    /// Vector of buffered column pages. Indexed by column id.
    std::vector<RColumnBuf> fBufferedColumns;
+   /// Number of bytes allocated for the buffered pages and their compression buffers, including the pages of a
+   /// cluster that is being written in the background
+   std::atomic<std::size_t> fNBytesBuffered{0};
+   /// Compressed size of the pages of the open cluster that were written early due to the page buffer budget
+   std::uint64_t fNBytesFlushedCluster = 0;
+   /// Owned compression scheduler, used if no task scheduler is set and the write options request zip threads.
+   /// Declared after fBufferedColumns so that the threads are joined before the buffered pages are destroyed.
+   std::unique_ptr<RZipThreadPool> fZipThreadPool;
+   /// The background write of the previously committed cluster, if asynchronous cluster writes are enabled.
+   /// Declared after fInnerSink so that the destructor waits for the write before the inner sink is destroyed.
+   std::future<void> fPendingWrite;
+
+   /// Blocks until the background write of the previous cluster, if any, is finished
+   void WaitForPendingWrite();
+   /// Blocks until all scheduled compression tasks of the open cluster are finished
+   void WaitForZipTasks();
+   using DrainedPages_t = std::deque<std::pair<ColumnHandle_t, std::deque<RColumnBuf::RPageZipItem>>>;
+   /// Removes all the buffered pages from the column buffers
+   DrainedPages_t DrainBufferedPages();
+   /// Compresses the pages that were not yet sealed by a compression task.  Returns the sum of the sealed page sizes.
+   std::uint64_t SealBufferedPages(DrainedPages_t &pages);
+   /// Writes the given sealed pages to the inner sink and releases them
+   void CommitBufferedPages(DrainedPages_t &pages);
+   /// Writes the pages buffered so far for the open cluster to the inner sink in order to stay within the
+   /// page buffer budget
+   void FlushBufferedPages();
 
 protected:
    void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
@@ -122,9 +202,9 @@ public:
    explicit RPageSinkBuf(std::unique_ptr<RPageSink> inner);
    RPageSinkBuf(const RPageSinkBuf&) = delete;
    RPageSinkBuf& operator=(const RPageSinkBuf&) = delete;
-   RPageSinkBuf(RPageSinkBuf&&) = default;
-   RPageSinkBuf& operator=(RPageSinkBuf&&) = default;
-   virtual ~RPageSinkBuf() = default;
+   RPageSinkBuf(RPageSinkBuf&&) = delete;
+   RPageSinkBuf& operator=(RPageSinkBuf&&) = delete;
+   virtual ~RPageSinkBuf();
 
    RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final;
    void ReleasePage(RPage &page) final;
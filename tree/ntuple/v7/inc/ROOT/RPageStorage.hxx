@@ -86,6 +86,8 @@ public:
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      /// The range of the values in the page, if known
+      RClusterDescriptor::RValueRange fValueRange;
 
       RSealedPage() = default;
       RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
@@ -186,6 +188,8 @@ protected:
    std::vector<RClusterDescriptor::RColumnRange> fOpenColumnRanges;
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
+   /// Computes the value range of a page of a column; nullptr for columns without value ranges. Indexed by column id.
+   std::vector<RClusterDescriptor::RValueRange (*)(const void *, std::size_t)> fValueRangeFuncs;
    RNTupleDescriptorBuilder fDescriptorBuilder;
 
    virtual void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) = 0;
@@ -210,6 +214,10 @@ protected:
    static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element,
       int compressionSetting, void *buf);
 
+   /// Returns the range of the values of the page if the sink records value ranges for the column, see
+   /// RNTupleWriteOptions::SetUseValueRanges(); otherwise the returned range is invalid.
+   RClusterDescriptor::RValueRange GetValueRange(ColumnHandle_t columnHandle, const RPage &page) const;
+
    /// Enables the default set of metrics provided by RPageSink. `prefix` will be used as the prefix for
    /// the counters registered in the internal RNTupleMetrics object.
    /// This set of counters can be extended by a subclass by calling `fMetrics.MakeCounter<...>()`.
@@ -236,6 +244,8 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
    /// Returns the sink's write options.
    const RNTupleWriteOptions &GetWriteOptions() const { return *fOptions; }
+   /// Returns the descriptor of the data written so far; the field and column ids are assigned by Create().
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
@@ -249,6 +259,9 @@ public:
    /// Write a preprocessed page to storage. The column must have been added before.
    /// TODO(jblomer): allow for vector commit of sealed pages
    void CommitSealedPage(DescriptorId_t columnId, const RPageStorage::RSealedPage &sealedPage);
+   /// Add a page that is already stored in the storage container of the sink, e.g. a page of the ntuple that is
+   /// replaced by an incremental merge (see RNTupleMerger), to the current cluster. No data is written.
+   void CommitExistingPage(DescriptorId_t columnId, const RClusterDescriptor::RPageRange::RPageInfo &pageInfo);
    /// Finalize the current cluster and create a new one for the following data.
    /// Returns the number of bytes written to storage (excluding meta-data).
    std::uint64_t CommitCluster(NTupleSize_t nEntries);
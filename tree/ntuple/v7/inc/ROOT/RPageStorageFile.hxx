@@ -133,6 +133,8 @@ private:
    std::unique_ptr<ROOT::Internal::RRawFile> fFile;
    /// Takes the fFile to read ntuple blobs from it
    Internal::RMiniFileReader fReader;
+   /// The anchor of the ntuple if it was given on construction; otherwise the anchor is looked up by name in the file
+   std::unique_ptr<RNTuple> fAnchor;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
 
@@ -154,6 +156,9 @@ protected:
 
 public:
    RPageSourceFile(std::string_view ntupleName, std::string_view path, const RNTupleReadOptions &options);
+   /// Reads the ntuple described by the given anchor through an open TFile, which can be any TFile subclass
+   /// (e.g. a TMemFile) and can be open for writing.  The file must stay alive during the lifetime of the page source.
+   RPageSourceFile(std::string_view ntupleName, TFile &file, const RNTuple &anchor, const RNTupleReadOptions &options);
    /// The cloned page source creates a new raw file and reader and opens its own file descriptor to the data.
    /// The meta-data (header and footer) is reread and parsed by the clone.
    std::unique_ptr<RPageSource> Clone() const final;
@@ -21,8 +21,113 @@
 #include <bitset>
 #include <cstdint>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
+namespace {
+
+/// Number of elements that are encoded into a stack buffer before their bytes are scattered to the byte planes
+/// of a split encoded page (and vice versa for decoding).  The block fits comfortably in the L1 cache and lets the
+/// compiler vectorize both the encoding and the byte transposition loops.
+constexpr std::size_t kSplitBlockSize = 64;
+
+/// Transforms the count elements in source with the encode function and stores the result in split encoding
+/// in destination: first the least significant bytes of all the elements, then the second bytes, etc.
+/// Like for the mappable column types, a little-endian host is assumed.
+template <typename StorageT, typename CppT, typename FEncode>
+void SplitPack(void *destination, const void *source, std::size_t count, FEncode encode)
+{
+   constexpr std::size_t kN = sizeof(StorageT);
+   auto srcArray = reinterpret_cast<const CppT *>(source);
+   auto splitArray = reinterpret_cast<unsigned char *>(destination);
+   StorageT block[kSplitBlockSize];
+   for (std::size_t offset = 0; offset < count; offset += kSplitBlockSize) {
+      const std::size_t n = std::min(kSplitBlockSize, count - offset);
+      for (std::size_t i = 0; i < n; ++i)
+         block[i] = encode(srcArray[offset + i]);
+      const auto blockBytes = reinterpret_cast<const unsigned char *>(block);
+      for (std::size_t b = 0; b < kN; ++b) {
+         unsigned char *plane = splitArray + b * count + offset;
+         for (std::size_t i = 0; i < n; ++i)
+            plane[i] = blockBytes[i * kN + b];
+      }
+   }
+}
+
+/// The inverse of SplitPack(): gathers the bytes of count elements from the byte planes in source and
+/// stores the elements transformed by the decode function in destination
+template <typename StorageT, typename CppT, typename FDecode>
+void SplitUnpack(void *destination, const void *source, std::size_t count, FDecode decode)
+{
+   constexpr std::size_t kN = sizeof(StorageT);
+   auto dstArray = reinterpret_cast<CppT *>(destination);
+   auto splitArray = reinterpret_cast<const unsigned char *>(source);
+   StorageT block[kSplitBlockSize];
+   for (std::size_t offset = 0; offset < count; offset += kSplitBlockSize) {
+      const std::size_t n = std::min(kSplitBlockSize, count - offset);
+      auto blockBytes = reinterpret_cast<unsigned char *>(block);
+      for (std::size_t b = 0; b < kN; ++b) {
+         const unsigned char *plane = splitArray + b * count + offset;
+         for (std::size_t i = 0; i < n; ++i)
+            blockBytes[i * kN + b] = plane[i];
+      }
+      for (std::size_t i = 0; i < n; ++i)
+         dstArray[offset + i] = decode(block[i]);
+   }
+}
+
+/// Maps signed integers of small magnitude to unsigned integers with many leading zero bytes:
+/// 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...
+template <typename T>
+typename std::make_unsigned<T>::type ZigzagEncode(T value)
+{
+   using UnsignedT = typename std::make_unsigned<T>::type;
+   return static_cast<UnsignedT>(static_cast<UnsignedT>(value) << 1) ^
+          static_cast<UnsignedT>(value >> (8 * sizeof(T) - 1));
+}
+
+template <typename T>
+T ZigzagDecode(typename std::make_unsigned<T>::type value)
+{
+   using UnsignedT = typename std::make_unsigned<T>::type;
+   return static_cast<T>(static_cast<UnsignedT>(value >> 1) ^ static_cast<UnsignedT>(-static_cast<T>(value & 1)));
+}
+
+/// Split encoding of floating point values or integers without a transformation of the values
+template <typename CppT>
+void CastSplitPack(void *destination, const void *source, std::size_t count)
+{
+   SplitPack<CppT, CppT>(destination, source, count, [](CppT value) { return value; });
+}
+
+template <typename CppT>
+void CastSplitUnpack(void *destination, const void *source, std::size_t count)
+{
+   SplitUnpack<CppT, CppT>(destination, source, count, [](CppT value) { return value; });
+}
+
+/// Split encoding of zigzag encoded integers; the in-memory type CppT may be wider than the on-disk type NarrowT
+/// and it may be unsigned, in which case it is stored as its two's complement reinterpretation
+template <typename NarrowT, typename CppT>
+void ZigzagSplitPack(void *destination, const void *source, std::size_t count)
+{
+   using SignedT = typename std::make_signed<NarrowT>::type;
+   using UnsignedT = typename std::make_unsigned<NarrowT>::type;
+   SplitPack<UnsignedT, CppT>(destination, source, count,
+                              [](CppT value) { return ZigzagEncode(static_cast<SignedT>(value)); });
+}
+
+template <typename NarrowT, typename CppT>
+void ZigzagSplitUnpack(void *destination, const void *source, std::size_t count)
+{
+   using SignedT = typename std::make_signed<NarrowT>::type;
+   using UnsignedT = typename std::make_unsigned<NarrowT>::type;
+   SplitUnpack<UnsignedT, CppT>(destination, source, count,
+                                [](UnsignedT value) { return static_cast<CppT>(ZigzagDecode<SignedT>(value)); });
+}
+
+} // anonymous namespace
+
 std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    switch (type) {
@@ -48,6 +153,18 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
       return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
       return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kSplitIndex32:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32>>(nullptr);
+   case EColumnType::kSplitReal64:
+      return std::make_unique<RColumnElement<double, EColumnType::kSplitReal64>>(nullptr);
+   case EColumnType::kSplitReal32:
+      return std::make_unique<RColumnElement<float, EColumnType::kSplitReal32>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
+   case EColumnType::kSplitInt16:
+      return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>(nullptr);
    default:
       R__ASSERT(false);
    }
@@ -79,6 +196,18 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
       return 32;
    case EColumnType::kSwitch:
       return 64;
+   case EColumnType::kSplitIndex32:
+      return 32;
+   case EColumnType::kSplitReal64:
+      return 64;
+   case EColumnType::kSplitReal32:
+      return 32;
+   case EColumnType::kSplitInt64:
+      return 64;
+   case EColumnType::kSplitInt32:
+      return 32;
+   case EColumnType::kSplitInt16:
+      return 16;
    default:
       R__ASSERT(false);
    }
@@ -110,6 +239,18 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
       return "Index";
    case EColumnType::kSwitch:
       return "Switch";
+   case EColumnType::kSplitIndex32:
+      return "SplitIndex32";
+   case EColumnType::kSplitReal64:
+      return "SplitReal64";
+   case EColumnType::kSplitReal32:
+      return "SplitReal32";
+   case EColumnType::kSplitInt64:
+      return "SplitInt64";
+   case EColumnType::kSplitInt32:
+      return "SplitInt32";
+   case EColumnType::kSplitInt16:
+      return "SplitInt16";
    default:
       return "UNKNOWN";
    }
@@ -169,3 +310,136 @@ void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental
       int64Array[i] = int32Array[i];
    }
 }
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitPack<float>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitUnpack<float>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitPack<double>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   CastSplitUnpack<double>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitPack<std::int16_t, std::int16_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitUnpack<std::int16_t, std::int16_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitPack<std::int16_t, std::uint16_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint16_t, ROOT::Experimental::EColumnType::kSplitInt16>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitUnpack<std::int16_t, std::uint16_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitPack<std::int32_t, std::int32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitUnpack<std::int32_t, std::int32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitPack<std::int32_t, std::uint32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitUnpack<std::int32_t, std::uint32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitPack<std::int64_t, std::int64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitUnpack<std::int64_t, std::int64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitPack<std::int64_t, std::uint64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitUnpack<std::int64_t, std::uint64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitPack<std::int32_t, std::int64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ZigzagSplitUnpack<std::int32_t, std::int64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                                ROOT::Experimental::EColumnType::kSplitIndex32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   // Offsets are monotonically increasing within a page; their deltas are the (small) collection sizes.
+   // The first element is stored as is so that pages can be decoded independently from each other.
+   ClusterSize_t::ValueType prev = 0;
+   SplitPack<ClusterSize_t::ValueType, ClusterSize_t>(dst, src, count, [&prev](ClusterSize_t value) {
+      const ClusterSize_t::ValueType delta = value - prev;
+      prev = value;
+      return delta;
+   });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                                ROOT::Experimental::EColumnType::kSplitIndex32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   ClusterSize_t::ValueType prev = 0;
+   SplitUnpack<ClusterSize_t::ValueType, ClusterSize_t>(dst, src, count, [&prev](ClusterSize_t::ValueType delta) {
+      prev += delta;
+      return ClusterSize_t(prev);
+   });
+}
@@ -339,9 +339,22 @@ ROOT::Experimental::EColumnType ROOT::Experimental::Detail::RFieldBase::EnsureCo
 }
 
 
+std::string ROOT::Experimental::Detail::RFieldBase::GetQualifiedFieldName() const
+{
+   std::string result = GetName();
+   auto parent = GetParent();
+   while (parent && !parent->GetName().empty()) {
+      result = parent->GetName() + "." + result;
+      parent = parent->GetParent();
+   }
+   return result;
+}
+
+
 void ROOT::Experimental::Detail::RFieldBase::ConnectPageSink(RPageSink &pageSink)
 {
    R__ASSERT(fColumns.empty());
+   fUseSplitEncoding = pageSink.GetWriteOptions().GetUseSplitEncoding(GetQualifiedFieldName());
    GenerateColumnsImpl();
    if (!fColumns.empty())
       fPrincipalColumn = fColumns[0].get();
@@ -433,14 +446,21 @@ void ROOT::Experimental::RFieldZero::AcceptVisitor(Detail::RFieldVisitor &visito
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel model(EColumnType::kSplitIndex32, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(model, 0)));
+   } else {
+      RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc);
+   fUseSplitEncoding = (type == EColumnType::kSplitIndex32);
    GenerateColumnsImpl();
 }
 
@@ -535,14 +555,21 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<float, EColumnType::kReal32>(model, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel model(EColumnType::kSplitReal32, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<float, EColumnType::kSplitReal32>(model, 0)));
+   } else {
+      RColumnModel model(EColumnType::kReal32, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<float, EColumnType::kReal32>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kReal32}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kReal32, EColumnType::kSplitReal32}, 0, desc);
+   fUseSplitEncoding = (type == EColumnType::kSplitReal32);
    GenerateColumnsImpl();
 }
 
@@ -556,14 +583,21 @@ void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &vis
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal64, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<double, EColumnType::kReal64>(model, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel model(EColumnType::kSplitReal64, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<double, EColumnType::kSplitReal64>(model, 0)));
+   } else {
+      RColumnModel model(EColumnType::kReal64, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<double, EColumnType::kReal64>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kReal64}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kReal64, EColumnType::kSplitReal64}, 0, desc);
+   fUseSplitEncoding = (type == EColumnType::kSplitReal64);
    GenerateColumnsImpl();
 }
 
@@ -576,14 +610,21 @@ void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &vi
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int16_t, EColumnType::kInt16>(model, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel model(EColumnType::kSplitInt16, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int16_t, EColumnType::kSplitInt16>(model, 0)));
+   } else {
+      RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int16_t, EColumnType::kInt16>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt16}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kInt16, EColumnType::kSplitInt16}, 0, desc);
+   fUseSplitEncoding = (type == EColumnType::kSplitInt16);
    GenerateColumnsImpl();
 }
 
@@ -596,14 +637,21 @@ void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::uint16_t, EColumnType::kInt16>(model, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel model(EColumnType::kSplitInt16, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint16_t, EColumnType::kSplitInt16>(model, 0)));
+   } else {
+      RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint16_t, EColumnType::kInt16>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt16}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kInt16, EColumnType::kSplitInt16}, 0, desc);
+   fUseSplitEncoding = (type == EColumnType::kSplitInt16);
    GenerateColumnsImpl();
 }
 
@@ -616,14 +664,21 @@ void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int32_t, EColumnType::kInt32>(model, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel model(EColumnType::kSplitInt32, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int32_t, EColumnType::kSplitInt32>(model, 0)));
+   } else {
+      RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int32_t, EColumnType::kInt32>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt32}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kInt32, EColumnType::kSplitInt32}, 0, desc);
+   fUseSplitEncoding = (type == EColumnType::kSplitInt32);
    GenerateColumnsImpl();
 }
 
@@ -636,14 +691,21 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint32_t, EColumnType::kInt32>(model, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel model(EColumnType::kSplitInt32, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint32_t, EColumnType::kSplitInt32>(model, 0)));
+   } else {
+      RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint32_t, EColumnType::kInt32>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt32}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kInt32, EColumnType::kSplitInt32}, 0, desc);
+   fUseSplitEncoding = (type == EColumnType::kSplitInt32);
    GenerateColumnsImpl();
 }
 
@@ -656,14 +718,21 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint64_t, EColumnType::kInt64>(model, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel model(EColumnType::kSplitInt64, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint64_t, EColumnType::kSplitInt64>(model, 0)));
+   } else {
+      RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint64_t, EColumnType::kInt64>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt64}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kInt64, EColumnType::kSplitInt64}, 0, desc);
+   fUseSplitEncoding = (type == EColumnType::kSplitInt64);
    GenerateColumnsImpl();
 }
 
@@ -676,21 +745,38 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel model(EColumnType::kSplitInt64, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int64_t, EColumnType::kSplitInt64>(model, 0)));
+   } else {
+      RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto type = EnsureColumnType({EColumnType::kInt64, EColumnType::kInt32}, 0, desc);
+   auto type = EnsureColumnType(
+      {EColumnType::kInt64, EColumnType::kInt32, EColumnType::kSplitInt64, EColumnType::kSplitInt32}, 0, desc);
    RColumnModel model(type, false /* isSorted*/);
-   if (type == EColumnType::kInt64) {
+   switch (type) {
+   case EColumnType::kInt64:
       fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
          Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
-   } else {
+      break;
+   case EColumnType::kInt32:
       fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
          Detail::RColumn::Create<std::int64_t, EColumnType::kInt32>(model, 0)));
+      break;
+   case EColumnType::kSplitInt64:
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int64_t, EColumnType::kSplitInt64>(model, 0)));
+      break;
+   default:
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int64_t, EColumnType::kSplitInt32>(model, 0)));
    }
 }
 
@@ -703,9 +789,15 @@ void ROOT::Experimental::RField<std::int64_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel modelIndex(EColumnType::kSplitIndex32, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(modelIndex, 0)));
+   } else {
+      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   }
 
    RColumnModel modelChars(EColumnType::kChar, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
@@ -714,7 +806,8 @@ void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc);
+   fUseSplitEncoding = (type == EColumnType::kSplitIndex32);
    EnsureColumnType({EColumnType::kChar}, 1, desc);
    GenerateColumnsImpl();
 }
@@ -1051,14 +1144,21 @@ void ROOT::Experimental::RVectorField::ReadGlobalImpl(NTupleSize_t globalIndex,
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel modelIndex(EColumnType::kSplitIndex32, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(modelIndex, 0)));
+   } else {
+      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   }
 }
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc);
+   fUseSplitEncoding = (type == EColumnType::kSplitIndex32);
    GenerateColumnsImpl();
 }
 
@@ -1153,14 +1253,21 @@ void ROOT::Experimental::RField<std::vector<bool>>::ReadGlobalImpl(NTupleSize_t
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel modelIndex(EColumnType::kSplitIndex32, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(modelIndex, 0)));
+   } else {
+      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc);
+   fUseSplitEncoding = (type == EColumnType::kSplitIndex32);
    GenerateColumnsImpl();
 }
 
@@ -1448,14 +1555,21 @@ ROOT::Experimental::RCollectionField::RCollectionField(
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   if (fUseSplitEncoding) {
+      RColumnModel modelIndex(EColumnType::kSplitIndex32, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(modelIndex, 0)));
+   } else {
+      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   }
 }
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc);
+   fUseSplitEncoding = (type == EColumnType::kSplitIndex32);
    GenerateColumnsImpl();
 }
 
@@ -17,6 +17,7 @@
 
 #include <ROOT/RFieldVisitor.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RPageSourceFriends.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
@@ -29,14 +30,17 @@
 #include <TROOT.h> // for IsImplicitMTEnabled()
 
 #include <algorithm>
+#include <cstring>
 #include <exception>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 
 #ifdef R__USE_IMT
@@ -273,6 +277,21 @@ void ROOT::Experimental::RNTupleReader::Show(NTupleSize_t index, const ENTupleSh
    }
 }
 
+std::vector<ROOT::Experimental::RNTupleGlobalRange>
+ROOT::Experimental::RNTupleReader::GetEntryRanges(std::string_view fieldName, double min, double max)
+{
+   auto descriptorGuard = fSource->GetSharedDescriptorGuard();
+   auto fieldId = descriptorGuard->FindFieldId(fieldName);
+   if (fieldId == kInvalidDescriptorId) {
+      throw RException(
+         R__FAIL("no field named '" + std::string(fieldName) + "' in RNTuple '" + descriptorGuard->GetName() + "'"));
+   }
+   std::vector<RNTupleGlobalRange> result;
+   for (const auto &range : descriptorGuard->FindEntryRanges(fieldId, min, max))
+      result.emplace_back(range.first, range.second);
+   return result;
+}
+
 const ROOT::Experimental::RNTupleDescriptor *ROOT::Experimental::RNTupleReader::GetDescriptor()
 {
    auto descriptorGuard = fSource->GetSharedDescriptorGuard();
@@ -287,37 +306,23 @@ const ROOT::Experimental::RNTupleDescriptor *ROOT::Experimental::RNTupleReader::
 ROOT::Experimental::RNTupleWriter::RNTupleWriter(
    std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
    std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
-   : fSink(std::move(sink))
-   , fModel(std::move(model))
+   : fFillContext(std::move(model), std::move(sink))
    , fMetrics("RNTupleWriter")
 {
-   if (!fModel) {
-      throw RException(R__FAIL("null model"));
-   }
-   if (!fSink) {
-      throw RException(R__FAIL("null sink"));
-   }
-   fModel->Freeze();
 #ifdef R__USE_IMT
    if (IsImplicitMTEnabled()) {
       fZipTasks = std::make_unique<RNTupleImtTaskScheduler>();
-      fSink->SetTaskScheduler(fZipTasks.get());
+      fFillContext.fSink->SetTaskScheduler(fZipTasks.get());
    }
 #endif
-   fSink->Create(*fModel.get());
-   fMetrics.ObserveMetrics(fSink->GetMetrics());
-
-   const auto &writeOpts = fSink->GetWriteOptions();
-   fMaxUnzippedClusterSize = writeOpts.GetMaxUnzippedClusterSize();
-   // First estimate is a factor 2 compression if compression is used at all
-   const int scale = writeOpts.GetCompression() ? 2 : 1;
-   fUnzippedClusterSizeEst = scale * writeOpts.GetApproxZippedClusterSize();
+   fFillContext.fSink->Create(*fFillContext.fModel);
+   fMetrics.ObserveMetrics(fFillContext.fSink->GetMetrics());
 }
 
 ROOT::Experimental::RNTupleWriter::~RNTupleWriter()
 {
    CommitCluster(true /* commitClusterGroup */);
-   fSink->CommitDataset();
+   fFillContext.fSink->CommitDataset();
 }
 
 std::unique_ptr<ROOT::Experimental::RNTupleWriter> ROOT::Experimental::RNTupleWriter::Recreate(
@@ -345,20 +350,148 @@ std::unique_ptr<ROOT::Experimental::RNTupleWriter> ROOT::Experimental::RNTupleWr
 
 void ROOT::Experimental::RNTupleWriter::CommitClusterGroup()
 {
-   if (fNEntries == fLastCommittedClusterGroup)
+   if (fFillContext.fNEntries == fLastCommittedClusterGroup)
       return;
-   fSink->CommitClusterGroup();
-   fLastCommittedClusterGroup = fNEntries;
+   fFillContext.fSink->CommitClusterGroup();
+   fLastCommittedClusterGroup = fFillContext.fNEntries;
 }
 
 void ROOT::Experimental::RNTupleWriter::CommitCluster(bool commitClusterGroup)
 {
-   if (fNEntries == fLastCommitted) {
-      if (commitClusterGroup)
-         CommitClusterGroup();
-      return;
+   fFillContext.CommitCluster();
+   if (commitClusterGroup)
+      CommitClusterGroup();
+}
+
+
+//------------------------------------------------------------------------------
+
+
+/// The page sink of a fill context.  Pages are sealed, i.e. packed and compressed, right when they are committed by
+/// the columns, in the filling thread.  The sealed pages of the open cluster are kept until the cluster is committed;
+/// then they are written together with the cluster into the parallel writer's sink while holding the writer's lock.
+/// The fill context's model is a clone of the writer's model, so that the column ids issued by this sink match the
+/// column ids of the writer's sink.
+class ROOT::Experimental::RNTupleParallelWriter::RFillContextSink : public Detail::RPageSink {
+private:
+   struct RSealedPageBuf {
+      std::unique_ptr<unsigned char[]> fBuf;
+      RSealedPage fSealedPage;
+   };
+
+   RNTupleParallelWriter &fWriter;
+   /// The sealed pages of the open cluster. Indexed by column id.
+   std::vector<std::vector<RSealedPageBuf>> fSealedPages;
+
+protected:
+   void CreateImpl(const RNTupleModel & /* model */, unsigned char * /* serializedHeader */,
+                   std::uint32_t /* length */) final
+   {
+      fSealedPages.resize(fDescriptorBuilder.GetDescriptor().GetNColumns());
+   }
+
+   RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const Detail::RPage &page) final
+   {
+      RSealedPageBuf sealedPageBuf;
+      sealedPageBuf.fBuf = std::make_unique<unsigned char[]>(page.GetNBytes());
+      auto sealedPage = SealPage(page, *columnHandle.fColumn->GetElement(), GetWriteOptions().GetCompression(),
+                                 sealedPageBuf.fBuf.get());
+      // Uncompressed pages of mappable columns are not copied by SealPage(); the column reuses its page buffer
+      if (sealedPage.fBuffer != sealedPageBuf.fBuf.get()) {
+         memcpy(sealedPageBuf.fBuf.get(), sealedPage.fBuffer, sealedPage.fSize);
+         sealedPage.fBuffer = sealedPageBuf.fBuf.get();
+      }
+      sealedPage.fValueRange = GetValueRange(columnHandle, page);
+      sealedPageBuf.fSealedPage = std::move(sealedPage);
+      fSealedPages.at(columnHandle.fId).emplace_back(std::move(sealedPageBuf));
+      // The locators of this sink are never written out
+      return RNTupleLocator{};
+   }
+
+   RNTupleLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final
+   {
+      RSealedPageBuf sealedPageBuf;
+      sealedPageBuf.fBuf = std::make_unique<unsigned char[]>(sealedPage.fSize);
+      memcpy(sealedPageBuf.fBuf.get(), sealedPage.fBuffer, sealedPage.fSize);
+      sealedPageBuf.fSealedPage = RSealedPage{sealedPageBuf.fBuf.get(), sealedPage.fSize, sealedPage.fNElements};
+      sealedPageBuf.fSealedPage.fValueRange = sealedPage.fValueRange;
+      fSealedPages.at(columnId).emplace_back(std::move(sealedPageBuf));
+      return RNTupleLocator{};
+   }
+
+   std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final
+   {
+      std::uint64_t nbytes;
+      {
+         std::lock_guard<std::mutex> lockGuard(fWriter.fMutex);
+         for (DescriptorId_t i = 0; i < fSealedPages.size(); ++i) {
+            for (const auto &sealedPageBuf : fSealedPages[i])
+               fWriter.fSink->CommitSealedPage(i, sealedPageBuf.fSealedPage);
+         }
+         fWriter.fNEntries += nEntries - fPrevClusterNEntries;
+         nbytes = fWriter.fSink->CommitCluster(fWriter.fNEntries);
+      }
+      for (auto &sealedPages : fSealedPages)
+         sealedPages.clear();
+      return nbytes;
+   }
+
+   RNTupleLocator CommitClusterGroupImpl(unsigned char * /* serializedPageList */, std::uint32_t /* length */) final
+   {
+      // Cluster groups are committed by the parallel writer
+      return RNTupleLocator{};
+   }
+
+   void CommitDatasetImpl(unsigned char * /* serializedFooter */, std::uint32_t /* length */) final {}
+
+public:
+   explicit RFillContextSink(RNTupleParallelWriter &writer)
+      : RPageSink(writer.fSink->GetNTupleName(), writer.fSink->GetWriteOptions()), fWriter(writer)
+   {
+   }
+
+   Detail::RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final
+   {
+      if (nElements == 0)
+         throw RException(R__FAIL("invalid call: request empty page"));
+      auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+      return Detail::RPageAllocatorHeap::NewPage(columnHandle.fId, elementSize, nElements);
+   }
+
+   void ReleasePage(Detail::RPage &page) final { Detail::RPageAllocatorHeap::DeletePage(page); }
+};
+
+
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(std::unique_ptr<RNTupleModel> model,
+                                                           std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model))
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
+   }
+   if (!fSink) {
+      throw RException(R__FAIL("null sink"));
    }
-   for (auto& field : *fModel->GetFieldZero()) {
+   // Assigns a new model id so that entries of different fill contexts cannot be mixed up
+   fModel->Freeze();
+
+   const auto &writeOpts = fSink->GetWriteOptions();
+   fMaxUnzippedClusterSize = writeOpts.GetMaxUnzippedClusterSize();
+   // First estimate is a factor 2 compression if compression is used at all
+   const int scale = writeOpts.GetCompression() ? 2 : 1;
+   fUnzippedClusterSizeEst = scale * writeOpts.GetApproxZippedClusterSize();
+}
+
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   CommitCluster();
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted)
+      return;
+   for (auto &field : *fModel->GetFieldZero()) {
       field.Flush();
       field.CommitCluster();
    }
@@ -366,20 +499,73 @@ void ROOT::Experimental::RNTupleWriter::CommitCluster(bool commitClusterGroup)
    fNBytesFilled += fUnzippedClusterSize;
 
    // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
-   const float compressionFactor = std::min(1000.f,
-      static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
+   const float compressionFactor =
+      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
    fUnzippedClusterSizeEst =
       compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
 
    fLastCommitted = fNEntries;
    fUnzippedClusterSize = 0;
+}
 
-   if (commitClusterGroup)
-      CommitClusterGroup();
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleParallelWriter")
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
+   }
+   if (!fSink) {
+      throw RException(R__FAIL("null sink"));
+   }
+   if (fModel->IsFrozen()) {
+      throw RException(R__FAIL("the model of a parallel writer must not be frozen"));
+   }
+   fPrototypeModel = fModel->Clone();
+   fModel->Freeze();
+   fSink->Create(*fModel.get());
+   fMetrics.ObserveMetrics(fSink->GetMetrics());
 }
 
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   if (fNEntries > 0)
+      fSink->CommitClusterGroup();
+   fSink->CommitDataset();
+}
 
-//------------------------------------------------------------------------------
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> ROOT::Experimental::RNTupleParallelWriter::Recreate(
+   std::unique_ptr<RNTupleModel> model, std::string_view ntupleName, std::string_view storage,
+   const RNTupleWriteOptions &options)
+{
+   // The fill contexts buffer and compress the pages of their clusters themselves
+   auto unbufferedOptions = options.Clone();
+   unbufferedOptions->SetUseBufferedWrite(false);
+   return std::make_unique<RNTupleParallelWriter>(std::move(model),
+                                                  Detail::RPageSink::Create(ntupleName, storage, *unbufferedOptions));
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Append(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                  TFile &file, const RNTupleWriteOptions &options)
+{
+   auto sink = std::make_unique<Detail::RPageSinkFile>(ntupleName, file, options);
+   return std::make_unique<RNTupleParallelWriter>(std::move(model), std::move(sink));
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleFillContext> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   std::unique_ptr<RNTupleModel> model;
+   {
+      std::lock_guard<std::mutex> lockGuard(fMutex);
+      model = fPrototypeModel->Clone();
+   }
+   auto sink = std::make_unique<RFillContextSink>(*this);
+   auto context = std::unique_ptr<RNTupleFillContext>(new RNTupleFillContext(std::move(model), std::move(sink)));
+   context->fSink->Create(*context->fModel);
+   return context;
+}
 
 
 ROOT::Experimental::RCollectionNTupleWriter::RCollectionNTupleWriter(std::unique_ptr<REntry> defaultEntry)
@@ -315,6 +315,60 @@ ROOT::Experimental::RNTupleDescriptor::FindPrevClusterId(DescriptorId_t clusterI
    return kInvalidDescriptorId;
 }
 
+std::vector<std::pair<ROOT::Experimental::NTupleSize_t, ROOT::Experimental::NTupleSize_t>>
+ROOT::Experimental::RNTupleDescriptor::FindEntryRanges(DescriptorId_t fieldId, double min, double max) const
+{
+   auto itrField = fFieldDescriptors.find(fieldId);
+   if (itrField == fFieldDescriptors.end())
+      throw RException(R__FAIL("invalid field id: " + std::to_string(fieldId)));
+   const auto &fieldDesc = itrField->second;
+   // Only for top-level leaf fields, the element index of the principal column is equal to the entry index
+   if (fieldDesc.GetParentId() != GetFieldZeroId() || fieldDesc.GetStructure() != ENTupleStructure::kLeaf ||
+       fieldDesc.GetNRepetitions() > 0) {
+      throw RException(R__FAIL("entry ranges can only be searched for top-level fields of arithmetic type, not for '" +
+                               fieldDesc.GetFieldName() + "'"));
+   }
+   const auto columnId = FindColumnId(fieldId, 0);
+   if (columnId == kInvalidDescriptorId)
+      throw RException(R__FAIL("field '" + fieldDesc.GetFieldName() + "' has no columns"));
+
+   std::vector<const RClusterDescriptor *> clusters;
+   for (const auto &cd : fClusterDescriptors)
+      clusters.emplace_back(&cd.second);
+   std::sort(clusters.begin(), clusters.end(), [](const RClusterDescriptor *a, const RClusterDescriptor *b) {
+      return a->GetFirstEntryIndex() < b->GetFirstEntryIndex();
+   });
+
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> ranges;
+   auto fnAddRange = [&ranges](NTupleSize_t first, NTupleSize_t end) {
+      if (first == end)
+         return;
+      if (!ranges.empty() && ranges.back().second == first)
+         ranges.back().second = end;
+      else
+         ranges.emplace_back(first, end);
+   };
+   for (const auto clusterDesc : clusters) {
+      const auto firstEntry = clusterDesc->GetFirstEntryIndex();
+      const auto endEntry = firstEntry + clusterDesc->GetNEntries();
+      if (!clusterDesc->HasPageLocations() || !clusterDesc->ContainsColumn(columnId)) {
+         fnAddRange(firstEntry, endEntry);
+         continue;
+      }
+      if (!clusterDesc->GetColumnRange(columnId).fValueRange.MayIntersect(min, max))
+         continue;
+
+      auto entry = firstEntry;
+      for (const auto &pi : clusterDesc->GetPageRange(columnId).fPageInfos) {
+         if (pi.fValueRange.MayIntersect(min, max))
+            fnAddRange(entry, entry + pi.fNElements);
+         entry += pi.fNElements;
+      }
+   }
+   return ranges;
+}
+
+
 ROOT::Experimental::RResult<void>
 ROOT::Experimental::RNTupleDescriptor::AddClusterDetails(RClusterDescriptor &&clusterDesc)
 {
@@ -405,10 +459,19 @@ ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(
       return R__FAIL("column ID mismatch");
    if (fCluster.fPageRanges.count(columnId) > 0)
       return R__FAIL("column ID conflict");
-   RClusterDescriptor::RColumnRange columnRange{columnId, firstElementIndex, RClusterSize(0)};
-   columnRange.fCompressionSettings = compressionSettings;
+   RClusterDescriptor::RColumnRange columnRange{columnId, firstElementIndex, RClusterSize(0), compressionSettings,
+                                                RClusterDescriptor::RValueRange()};
+   bool hasValueRange = !pageRange.fPageInfos.empty();
    for (const auto &pi : pageRange.fPageInfos) {
       columnRange.fNElements += pi.fNElements;
+      hasValueRange = hasValueRange && pi.fValueRange.fIsValid;
+   }
+   if (hasValueRange) {
+      columnRange.fValueRange = pageRange.fPageInfos[0].fValueRange;
+      for (const auto &pi : pageRange.fPageInfos) {
+         columnRange.fValueRange.fMin = std::min(columnRange.fValueRange.fMin, pi.fValueRange.fMin);
+         columnRange.fValueRange.fMax = std::max(columnRange.fValueRange.fMax, pi.fValueRange.fMax);
+      }
    }
    fCluster.fPageRanges[columnId] = pageRange.Clone();
    fCluster.fColumnRanges[columnId] = columnRange;
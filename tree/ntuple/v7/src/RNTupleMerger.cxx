@@ -13,17 +13,188 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorageFile.hxx>
 
-Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
-   if (inputs == nullptr || mergeInfo == nullptr) {
+#include <TCollection.h>
+#include <TError.h>
+#include <TFile.h>
+#include <TFileMergeInfo.h>
+#include <TIterator.h>
+#include <TKey.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Collects the ids of the columns of the given field and of all its subfields
+void CollectColumnIds(const ROOT::Experimental::RNTupleDescriptor &desc, ROOT::Experimental::DescriptorId_t fieldId,
+                      std::vector<ROOT::Experimental::DescriptorId_t> &columnIds)
+{
+   for (const auto &c : desc.GetColumnIterable(fieldId))
+      columnIds.emplace_back(c.GetId());
+   for (const auto &f : desc.GetFieldIterable(fieldId))
+      CollectColumnIds(desc, f.GetId(), columnIds);
+}
+
+/// Identifies a column independently of the column and field ids, which can differ among ntuples with the same schema
+std::string GetColumnKey(const ROOT::Experimental::RNTupleDescriptor &desc,
+                         const ROOT::Experimental::RColumnDescriptor &columnDesc)
+{
+   return desc.GetQualifiedFieldName(columnDesc.GetFieldId()) + ":" + std::to_string(columnDesc.GetIndex());
+}
+
+/// Releases the space of the invisible key (see RNTupleFileWriter::WriteBlob()) whose payload of nbytes is stored at
+/// the given offset of the file. Nothing is released if there is no such key.
+void ReleaseBlob(TFile &file, std::uint64_t offset, std::uint64_t nbytes)
+{
+   // The key of a blob has no name and no title; its header uses 32bit or 64bit offsets
+   for (std::uint64_t keylen : {34, 42}) {
+      if (offset < keylen)
+         continue;
+      const auto seekKey = offset - keylen;
+      std::vector<char> header(keylen);
+      if (file.ReadBuffer(header.data(), seekKey, keylen))
+         continue;
+      TKey key(&file);
+      char *buffer = header.data();
+      key.ReadKeyBuffer(buffer);
+      if (static_cast<std::uint64_t>(key.GetSeekKey()) != seekKey ||
+          static_cast<std::uint64_t>(key.GetKeylen()) != keylen ||
+          static_cast<std::uint64_t>(key.GetNbytes()) != keylen + nbytes || strcmp(key.GetClassName(), "RBlob") != 0)
+         continue;
+      file.MakeFree(seekKey, seekKey + keylen + nbytes - 1);
+      return;
+   }
+}
+
+/// Releases the space of the meta-data of the given ntuple and of its pages whose compression differs from the given
+/// one, i.e. all the blobs of an ntuple replaced by an incremental merge that are not referenced by the merged ntuple
+void ReleaseReplacedNTuple(TFile &file, const ROOT::Experimental::RNTuple &anchor,
+                           const ROOT::Experimental::RNTupleDescriptor &desc, int compression)
+{
+   ReleaseBlob(file, anchor.fSeekHeader, anchor.fNBytesHeader);
+   ReleaseBlob(file, anchor.fSeekFooter, anchor.fNBytesFooter);
+   for (const auto &clusterGroupDesc : desc.GetClusterGroupIterable()) {
+      const auto &locator = clusterGroupDesc.GetPageListLocator();
+      ReleaseBlob(file, locator.fPosition, locator.fBytesOnStorage);
+   }
+   for (const auto &clusterDesc : desc.GetClusterIterable()) {
+      for (ROOT::Experimental::DescriptorId_t i = 0; i < desc.GetNColumns(); ++i) {
+         if (!clusterDesc.ContainsColumn(i) || clusterDesc.GetColumnRange(i).fCompressionSettings == compression)
+            continue;
+         for (const auto &pageInfo : clusterDesc.GetPageRange(i).fPageInfos)
+            ReleaseBlob(file, pageInfo.fLocator.fPosition, pageInfo.fLocator.fBytesOnStorage);
+      }
+   }
+}
+
+} // anonymous namespace
+
+/// The input list is expected to contain the name of the ntuple (e.g., as a TObjString), the output TFile, and the
+/// input TFiles, in this order.  The inputs are read through the given TFile objects, so that any TFile subclass,
+/// e.g. TMemFile, can be merged.  Inputs that do not contain the ntuple are skipped.  The output file can itself be
+/// given as an input, for incremental merging: its ntuple is then replaced by the merged one, which references the
+/// pages already in the file rather than writing them again, and the space of the replaced meta-data is released.
+/// The output ntuple keeps the compression settings of the ntuple of the output file, if any, otherwise the ones of
+/// the first input.
+Long64_t ROOT::Experimental::RNTuple::Merge(TCollection *inputs, TFileMergeInfo *mergeInfo)
+{
+   if (inputs == nullptr || mergeInfo == nullptr || inputs->GetEntries() < 3) {
+      return -1;
+   }
+
+   TIter itr(inputs);
+   const std::string ntupleName = itr()->GetName();
+   TObject *outArg = itr();
+   auto outFile = dynamic_cast<TFile *>(outArg);
+   if (!outFile) {
+      Error("RNTuple::Merge", "second input parameter should be the output TFile but it is a %s", outArg->ClassName());
       return -1;
    }
-   return -1;
+
+   std::vector<std::unique_ptr<Detail::RPageSourceFile>> sources;
+   std::vector<Detail::RPageSource *> sourcePtrs;
+   // The ntuple of the output file if the output file is an input, i.e. for incremental merging
+   Detail::RPageSource *inPlaceSource = nullptr;
+   RNTuple outAnchor;
+   Short_t outCycle = 0;
+   while (auto inArg = itr()) {
+      auto inFile = dynamic_cast<TFile *>(inArg);
+      if (!inFile) {
+         Error("RNTuple::Merge", "cannot merge ntuple %s from %s: only ntuples in the top-level directory of a file "
+               "are supported", ntupleName.c_str(), inArg->GetName());
+         return -1;
+      }
+      TKey *key = inFile->GetKey(ntupleName.c_str());
+      std::unique_ptr<RNTuple> anchor(key ? key->ReadObject<RNTuple>() : nullptr);
+      if (!anchor) {
+         Warning("RNTuple::Merge", "skipping %s, which does not contain the ntuple %s", inFile->GetName(),
+                 ntupleName.c_str());
+         continue;
+      }
+      sources.emplace_back(
+         std::make_unique<Detail::RPageSourceFile>(ntupleName, *inFile, *anchor, RNTupleReadOptions()));
+      sourcePtrs.emplace_back(sources.back().get());
+      if (inFile == outFile) {
+         inPlaceSource = sources.back().get();
+         outAnchor = *anchor;
+         outCycle = key->GetCycle();
+      }
+   }
+   if (sources.empty()) {
+      Error("RNTuple::Merge", "none of the inputs contains the ntuple %s", ntupleName.c_str());
+      return -1;
+   }
+
+   RNTupleWriteOptions writeOptions;
+   try {
+      // Keeping the compression of the output ntuple, or else of the first input, allows for copying its pages
+      // without recompressing them, which in the common case of inputs written with the same settings holds for all
+      // the inputs.
+      for (auto source : sourcePtrs)
+         source->Attach();
+      {
+         auto descriptorGuard = (inPlaceSource ? inPlaceSource : sourcePtrs[0])->GetSharedDescriptorGuard();
+         for (const auto &clusterDesc : descriptorGuard->GetClusterIterable()) {
+            for (DescriptorId_t i = 0; i < descriptorGuard->GetNColumns(); ++i) {
+               if (clusterDesc.ContainsColumn(i)) {
+                  writeOptions.SetCompression(clusterDesc.GetColumnRange(i).fCompressionSettings);
+                  break;
+               }
+            }
+            break;
+         }
+      }
+      Detail::RPageSinkFile destination(ntupleName, *outFile, writeOptions);
+      RNTupleMerger merger;
+      merger.Merge(sourcePtrs, destination, inPlaceSource);
+   } catch (const RException &e) {
+      Error("RNTuple::Merge", "cannot merge ntuple %s: %s", ntupleName.c_str(), e.GetError().GetReport().c_str());
+      return -1;
+   }
+   // The merged ntuple has been written under a new cycle of the key. It references the pages of the replaced ntuple
+   // that did not need to be recompressed; the space of everything else of the replaced ntuple is released.
+   if (inPlaceSource) {
+      outFile->Delete((ntupleName + ";" + std::to_string(outCycle)).c_str());
+      ReleaseReplacedNTuple(*outFile, outAnchor, inPlaceSource->GetSharedDescriptorGuard().GetRef(),
+                            writeOptions.GetCompression());
+   }
+   return 0;
 }
 
 
@@ -37,3 +208,116 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+void ROOT::Experimental::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources,
+                                              Detail::RPageSink &destination,
+                                              const Detail::RPageSource *inPlaceSource)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("no sources to merge"));
+
+   const auto destCompression = destination.GetWriteOptions().GetCompression();
+   std::unique_ptr<RNTupleModel> model;
+   // Maps the column keys to the column ids of the destination
+   std::unordered_map<std::string, DescriptorId_t> destColumnIds;
+   NTupleSize_t nEntries = 0;
+
+   Detail::RNTupleDecompressor decompressor;
+   // Scratch buffers for the sealed pages and, in case of recompression, the unzipped and the rezipped pages
+   std::vector<unsigned char> sealedBuffer;
+   std::vector<unsigned char> unzipBuffer;
+   std::vector<unsigned char> zipBuffer;
+
+   for (auto source : sources) {
+      // The descriptor is copied because LoadSealedPage() acquires the descriptor lock
+      auto descriptor = source->GetSharedDescriptorGuard()->Clone();
+
+      if (!model) {
+         model = descriptor->GenerateModel();
+         destination.Create(*model);
+         const auto &destDesc = destination.GetDescriptor();
+         std::vector<DescriptorId_t> columnIds;
+         CollectColumnIds(destDesc, destDesc.GetFieldZeroId(), columnIds);
+         for (auto columnId : columnIds)
+            destColumnIds[GetColumnKey(destDesc, destDesc.GetColumnDescriptor(columnId))] = columnId;
+      }
+
+      struct RColumnInfo {
+         DescriptorId_t fSourceId;
+         DescriptorId_t fDestId;
+         std::unique_ptr<Detail::RColumnElementBase> fElement;
+      };
+      std::vector<RColumnInfo> columns;
+      std::vector<DescriptorId_t> columnIds;
+      CollectColumnIds(*descriptor, descriptor->GetFieldZeroId(), columnIds);
+      if (columnIds.size() != destColumnIds.size())
+         throw RException(R__FAIL("ntuple " + descriptor->GetName() + " has a different number of columns"));
+      const auto &destDesc = destination.GetDescriptor();
+      for (auto columnId : columnIds) {
+         const auto &columnDesc = descriptor->GetColumnDescriptor(columnId);
+         const auto key = GetColumnKey(*descriptor, columnDesc);
+         auto itr = destColumnIds.find(key);
+         if (itr == destColumnIds.end())
+            throw RException(R__FAIL("column " + key + " is not part of the merged ntuple"));
+         const auto type = columnDesc.GetModel().GetType();
+         if (destDesc.GetColumnDescriptor(itr->second).GetModel().GetType() != type)
+            throw RException(R__FAIL("column " + key + " has a different type than in the merged ntuple"));
+         columns.emplace_back(RColumnInfo{columnId, itr->second, Detail::RColumnElementBase::Generate(type)});
+      }
+
+      std::vector<const RClusterDescriptor *> clusters;
+      for (const auto &clusterDesc : descriptor->GetClusterIterable())
+         clusters.emplace_back(&clusterDesc);
+      std::sort(clusters.begin(), clusters.end(), [](const RClusterDescriptor *a, const RClusterDescriptor *b) {
+         return a->GetFirstEntryIndex() < b->GetFirstEntryIndex();
+      });
+
+      for (auto clusterDesc : clusters) {
+         for (const auto &column : columns) {
+            if (!clusterDesc->ContainsColumn(column.fSourceId))
+               continue;
+            const auto srcCompression = clusterDesc->GetColumnRange(column.fSourceId).fCompressionSettings;
+            // The pages of the in-place source are already stored in the destination container
+            const bool isPageStored = (source == inPlaceSource) && (srcCompression == destCompression);
+            std::uint64_t idxInCluster = 0;
+            for (const auto &pageInfo : clusterDesc->GetPageRange(column.fSourceId).fPageInfos) {
+               if (isPageStored) {
+                  destination.CommitExistingPage(column.fDestId, pageInfo);
+                  continue;
+               }
+               const RClusterIndex clusterIndex(clusterDesc->GetId(), idxInCluster);
+               Detail::RPageStorage::RSealedPage sealedPage;
+               source->LoadSealedPage(column.fSourceId, clusterIndex, sealedPage);
+               if (sealedBuffer.size() < sealedPage.fSize)
+                  sealedBuffer.resize(sealedPage.fSize);
+               sealedPage.fBuffer = sealedBuffer.data();
+               source->LoadSealedPage(column.fSourceId, clusterIndex, sealedPage);
+
+               if (srcCompression != destCompression) {
+                  const auto packedSize = column.fElement->GetPackedSize(sealedPage.fNElements);
+                  if (unzipBuffer.size() < packedSize)
+                     unzipBuffer.resize(packedSize);
+                  if (zipBuffer.size() < packedSize)
+                     zipBuffer.resize(packedSize);
+                  decompressor.Unzip(sealedPage.fBuffer, sealedPage.fSize, packedSize, unzipBuffer.data());
+                  sealedPage.fSize =
+                     Detail::RNTupleCompressor::Zip(unzipBuffer.data(), packedSize, destCompression, zipBuffer.data());
+                  sealedPage.fBuffer = zipBuffer.data();
+               }
+
+               destination.CommitSealedPage(column.fDestId, sealedPage);
+               idxInCluster += pageInfo.fNElements;
+            }
+         }
+         nEntries += clusterDesc->GetNEntries();
+         destination.CommitCluster(nEntries);
+      }
+   }
+
+   destination.CommitClusterGroup();
+   destination.CommitDataset();
+}
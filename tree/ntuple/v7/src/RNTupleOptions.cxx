@@ -64,3 +64,11 @@ void ROOT::Experimental::RNTupleWriteOptions::SetApproxUnzippedPageSize(std::siz
    EnsureValidTunables(fApproxZippedClusterSize, fMaxUnzippedClusterSize, val);
    fApproxUnzippedPageSize = val;
 }
+
+bool ROOT::Experimental::RNTupleWriteOptions::GetUseSplitEncoding(const std::string &qualifiedFieldName) const
+{
+   auto itr = fFieldSplitEncoding.find(qualifiedFieldName);
+   if (itr == fFieldSplitEncoding.end())
+      return fUseSplitEncoding;
+   return itr->second;
+}
@@ -195,7 +195,8 @@ std::uint32_t SerializeColumnListV1(
          if (c.GetModel().GetIsSorted())
             flags |= RNTupleSerializer::kFlagSortAscColumn;
          // TODO(jblomer): fix for unsigned integer types
-         if (type == ROOT::Experimental::EColumnType::kIndex)
+         if (type == ROOT::Experimental::EColumnType::kIndex ||
+             type == ROOT::Experimental::EColumnType::kSplitIndex32)
             flags |= RNTupleSerializer::kFlagNonNegativeColumn;
          pos += RNTupleSerializer::SerializeUInt32(flags, *where);
 
@@ -382,6 +383,22 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeUInt64
    return DeserializeInt64(buffer, *reinterpret_cast<std::int64_t *>(&val));
 }
 
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeDouble(double val, void *buffer)
+{
+   static_assert(sizeof(double) == sizeof(std::uint64_t), "unsupported double size");
+   std::uint64_t bits;
+   memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeDouble(const void *buffer, double &val)
+{
+   std::uint64_t bits;
+   auto nbytes = DeserializeUInt64(buffer, bits);
+   memcpy(&val, &bits, sizeof(val));
+   return nbytes;
+}
+
 std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeString(const std::string &val, void *buffer)
 {
    if (buffer) {
@@ -441,6 +458,18 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
          return SerializeUInt16(0x0C, buffer);
       case EColumnType::kInt8:
          return SerializeUInt16(0x0D, buffer);
+      case EColumnType::kSplitIndex32:
+         return SerializeUInt16(0x0F, buffer);
+      case EColumnType::kSplitReal64:
+         return SerializeUInt16(0x10, buffer);
+      case EColumnType::kSplitReal32:
+         return SerializeUInt16(0x11, buffer);
+      case EColumnType::kSplitInt64:
+         return SerializeUInt16(0x13, buffer);
+      case EColumnType::kSplitInt32:
+         return SerializeUInt16(0x14, buffer);
+      case EColumnType::kSplitInt16:
+         return SerializeUInt16(0x15, buffer);
       default:
          throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
@@ -490,6 +519,24 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
       case 0x0D:
          type = EColumnType::kInt8;
          break;
+      case 0x0F:
+         type = EColumnType::kSplitIndex32;
+         break;
+      case 0x10:
+         type = EColumnType::kSplitReal64;
+         break;
+      case 0x11:
+         type = EColumnType::kSplitReal32;
+         break;
+      case 0x13:
+         type = EColumnType::kSplitInt64;
+         break;
+      case 0x14:
+         type = EColumnType::kSplitInt32;
+         break;
+      case 0x15:
+         type = EColumnType::kSplitInt16;
+         break;
       default:
          return R__FAIL("unexpected on-disk column type");
    }
@@ -1004,6 +1051,17 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
          pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
 
+         // Optional value ranges of the pages, only written if all the pages of the column range have one
+         if (columnRange.fValueRange.fIsValid) {
+            auto valueRangeFrame = pos;
+            pos += SerializeListFramePreamble(pageRange.fPageInfos.size(), *where);
+            for (const auto &pi : pageRange.fPageInfos) {
+               pos += SerializeDouble(pi.fValueRange.fMin, *where);
+               pos += SerializeDouble(pi.fValueRange.fMax, *where);
+            }
+            pos += SerializeFramePostscript(buffer ? valueRangeFrame : nullptr, pos - valueRangeFrame);
+         }
+
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
       }
       pos += SerializeFramePostscript(buffer ? outerFrame : nullptr, pos - outerFrame);
@@ -1383,7 +1441,7 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
             result = DeserializeLocator(bytes, fnInnerFrameSizeLeft(), locator);
             if (!result)
                return R__FORWARD_ERROR(result);
-            pageRange.fPageInfos.push_back({ClusterSize_t(nElements), locator});
+            pageRange.fPageInfos.push_back({ClusterSize_t(nElements), locator, {}});
             bytes += result.Unwrap();
          }
 
@@ -1394,6 +1452,24 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
          std::uint32_t compressionSettings;
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
+         if (fnInnerFrameSizeLeft() > 0) {
+            std::uint32_t valueRangeFrameSize;
+            std::uint32_t nValueRanges;
+            result = DeserializeFrameHeader(bytes, fnInnerFrameSizeLeft(), valueRangeFrameSize, nValueRanges);
+            if (!result)
+               return R__FORWARD_ERROR(result);
+            bytes += result.Unwrap();
+            if (nValueRanges != nPages)
+               return R__FAIL("mismatch of value ranges and pages");
+            if (fnInnerFrameSizeLeft() < static_cast<int>(nValueRanges * 2 * sizeof(double)))
+               return R__FAIL("value range frame too short");
+            for (auto &pi : pageRange.fPageInfos) {
+               bytes += DeserializeDouble(bytes, pi.fValueRange.fMin);
+               bytes += DeserializeDouble(bytes, pi.fValueRange.fMax);
+               pi.fValueRange.fIsValid = true;
+            }
+         }
+
          clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
          bytes = innerFrame + innerFrameSize;
       }
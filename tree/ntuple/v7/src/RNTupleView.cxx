@@ -0,0 +1,70 @@
+/// \file RNTupleView.cxx
+/// \ingroup NTuple ROOT7
+/// \author The ROOT Team
+/// \date 2026-10-17
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RError.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleView.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <string>
+
+ROOT::Experimental::NTupleSize_t
+ROOT::Experimental::RNTupleViewCollection::GetGlobalItemIndex(const RClusterIndex &clusterIndex)
+{
+   // The descriptor is only consulted when the items of a new cluster are addressed
+   if (clusterIndex.GetClusterId() == fItemClusterId)
+      return fItemClusterOffset + clusterIndex.GetIndex();
+
+   auto descriptorGuard = fSource->GetSharedDescriptorGuard();
+   if (fItemColumnId == kInvalidDescriptorId) {
+      // Use the first principal column found below the item field.  Record fields have no column, their first
+      // subfield has one element per item; fixed-size arrays have no column either, their item field has
+      // a fixed number of elements per item.
+      const auto &linkIds = descriptorGuard->GetFieldDescriptor(fCollectionFieldId).GetLinkIds();
+      auto fieldId = linkIds.empty() ? kInvalidDescriptorId : linkIds[0];
+      while (fieldId != kInvalidDescriptorId) {
+         fItemColumnId = descriptorGuard->FindColumnId(fieldId, 0);
+         if (fItemColumnId != kInvalidDescriptorId)
+            break;
+         const auto &fieldDesc = descriptorGuard->GetFieldDescriptor(fieldId);
+         if (fieldDesc.GetNRepetitions() > 0)
+            fNElementsPerItem *= fieldDesc.GetNRepetitions();
+         fieldId = fieldDesc.GetLinkIds().empty() ? kInvalidDescriptorId : fieldDesc.GetLinkIds()[0];
+      }
+      if (fItemColumnId == kInvalidDescriptorId) {
+         throw RException(R__FAIL("collection '" + descriptorGuard->GetQualifiedFieldName(fCollectionFieldId) +
+                                  "' has no item column"));
+      }
+   }
+   fItemClusterOffset = descriptorGuard->GetClusterDescriptor(clusterIndex.GetClusterId())
+                           .GetColumnRange(fItemColumnId)
+                           .fFirstElementIndex /
+                        fNElementsPerItem;
+   fItemClusterId = clusterIndex.GetClusterId();
+   return fItemClusterOffset + clusterIndex.GetIndex();
+}
+
+void ROOT::Experimental::RNTupleViewCollection::ReadOffsetsBulk(NTupleSize_t firstIndex, NTupleSize_t count,
+                                                                NTupleSize_t *offsets)
+{
+   ClusterSize_t size;
+   RClusterIndex collectionStart;
+   for (NTupleSize_t i = 0; i < count; ++i) {
+      fField.GetCollectionInfo(firstIndex + i, &collectionStart, &size);
+      offsets[i] = GetGlobalItemIndex(collectionStart);
+   }
+   if (count > 0)
+      offsets[count] = offsets[count - 1] + size;
+}
@@ -19,6 +19,79 @@
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
 
+#include <cstring>
+#include <utility>
+
+ROOT::Experimental::Detail::RPageSinkBuf::RZipThreadPool::RZipThreadPool(unsigned int nThreads)
+{
+   for (unsigned int i = 0; i < nThreads; ++i)
+      fThreads.emplace_back(&RZipThreadPool::ExecTasks, this);
+}
+
+ROOT::Experimental::Detail::RPageSinkBuf::RZipThreadPool::~RZipThreadPool()
+{
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      fIsTerminating = true;
+   }
+   fCvHasWork.notify_all();
+   for (auto &t : fThreads)
+      t.join();
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::RZipThreadPool::ExecTasks()
+{
+   while (true) {
+      std::function<void(void)> task;
+      {
+         std::unique_lock<std::mutex> lock(fLock);
+         fCvHasWork.wait(lock, [&]{ return fIsTerminating || !fTasks.empty(); });
+         if (fTasks.empty())
+            return;
+         task = std::move(fTasks.front());
+         fTasks.pop();
+      }
+
+      std::exception_ptr exception;
+      try {
+         task();
+      } catch (...) {
+         exception = std::current_exception();
+      }
+
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      if (exception && !fException)
+         fException = exception;
+      if (--fNUnfinished == 0)
+         fCvAllDone.notify_all();
+   }
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::RZipThreadPool::AddTask(const std::function<void(void)> &taskFunc)
+{
+   {
+      std::lock_guard<std::mutex> lockGuard(fLock);
+      fTasks.push(taskFunc);
+      ++fNUnfinished;
+   }
+   fCvHasWork.notify_one();
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::RZipThreadPool::Wait()
+{
+   std::unique_lock<std::mutex> lock(fLock);
+   fCvAllDone.wait(lock, [&]{ return fNUnfinished == 0; });
+   if (fException) {
+      auto exception = fException;
+      fException = nullptr;
+      std::rethrow_exception(exception);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+
+
 ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink> inner)
    : RPageSink(inner->GetNTupleName(), inner->GetWriteOptions())
    , fMetrics("RPageSinkBuf")
@@ -26,20 +99,120 @@ ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink
 {
    fCounters = std::unique_ptr<RCounters>(new RCounters{
       *fMetrics.MakeCounter<RNTuplePlainCounter*>("ParallelZip", "",
-         "compressing pages in parallel")
+         "compressing pages in parallel"),
+      *fMetrics.MakeCounter<RNTuplePlainCounter*>("AsyncClusterWrite", "",
+         "writing clusters in the background"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nFlushBudget", "",
+         "number of early page flushes due to the page buffer budget"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallWaitWrite", "ns",
+         "wall clock time spent waiting for background cluster writes"),
+      *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*>("timeCpuWaitWrite", "ns",
+         "CPU time spent waiting for background cluster writes")
    });
    fMetrics.ObserveMetrics(fInnerSink->GetMetrics());
 }
 
+ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
+{
+   // The background write must not outlive the buffered pages; errors are reported by CommitCluster() and
+   // CommitDataset(), not here
+   if (fPendingWrite.valid())
+      fPendingWrite.wait();
+}
+
 void ROOT::Experimental::Detail::RPageSinkBuf::CreateImpl(const RNTupleModel &model,
                                                           unsigned char * /* serializedHeader */,
                                                           std::uint32_t /* length */)
 {
    fBufferedColumns.resize(fDescriptorBuilder.GetDescriptor().GetNColumns());
+   // A scheduler set from the outside, e.g. the one of the RNTupleWriter for implicit multi-threading, takes
+   // precedence over the own thread pool
+   if (!fTaskScheduler && GetWriteOptions().GetZipThreads() > 0) {
+      fZipThreadPool = std::make_unique<RZipThreadPool>(GetWriteOptions().GetZipThreads());
+      fTaskScheduler = fZipThreadPool.get();
+   }
+   fCounters->fAsyncClusterWrite.SetValue(GetWriteOptions().GetUseAsyncClusterWrite());
    fInnerModel = model.Clone();
    fInnerSink->Create(*fInnerModel);
 }
 
+void ROOT::Experimental::Detail::RPageSinkBuf::WaitForPendingWrite()
+{
+   if (!fPendingWrite.valid())
+      return;
+   RNTupleAtomicTimer timer(fCounters->fTimeWallWaitWrite, fCounters->fTimeCpuWaitWrite);
+   // Rethrows a possible exception of the background write
+   fPendingWrite.get();
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::WaitForZipTasks()
+{
+   if (fTaskScheduler) {
+      fTaskScheduler->Wait();
+      fTaskScheduler->Reset();
+   }
+}
+
+ROOT::Experimental::Detail::RPageSinkBuf::DrainedPages_t
+ROOT::Experimental::Detail::RPageSinkBuf::DrainBufferedPages()
+{
+   DrainedPages_t pages;
+   for (auto &bufColumn : fBufferedColumns) {
+      auto drained = bufColumn.DrainBufferedPages();
+      if (!drained.empty())
+         pages.emplace_back(bufColumn.GetHandle(), std::move(drained));
+   }
+   return pages;
+}
+
+std::uint64_t ROOT::Experimental::Detail::RPageSinkBuf::SealBufferedPages(DrainedPages_t &pages)
+{
+   std::uint64_t nbytes = 0;
+   for (auto &[handle, bufPages] : pages) {
+      for (auto &bufPage : bufPages) {
+         if (!bufPage.IsSealed()) {
+            bufPage.AllocateSealedPageBuf();
+            fNBytesBuffered += bufPage.fPage.GetNBytes();
+            bufPage.fSealedPage = SealPage(bufPage.fPage, *handle.fColumn->GetElement(),
+                                           GetWriteOptions().GetCompression(), bufPage.fBuf.get());
+            bufPage.fSealedPage.fValueRange = GetValueRange(handle, bufPage.fPage);
+         }
+         nbytes += bufPage.fSealedPage.fSize;
+      }
+   }
+   return nbytes;
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CommitBufferedPages(DrainedPages_t &pages)
+{
+   for (auto &[handle, bufPages] : pages) {
+      for (auto &bufPage : bufPages) {
+         std::size_t nbytesReleased = bufPage.fPage.GetNBytes();
+         if (bufPage.IsSealed()) {
+            fInnerSink->CommitSealedPage(handle.fId, bufPage.fSealedPage);
+         } else {
+            fInnerSink->CommitPage(handle, bufPage.fPage);
+         }
+         if (bufPage.fBuf) {
+            nbytesReleased += bufPage.fPage.GetNBytes();
+            bufPage.fBuf.reset();
+         }
+         ReleasePage(bufPage.fPage);
+         fNBytesBuffered -= nbytesReleased;
+      }
+   }
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::FlushBufferedPages()
+{
+   fCounters->fNFlushBudget.Inc();
+   WaitForPendingWrite();
+   WaitForZipTasks();
+   auto pages = DrainBufferedPages();
+   fNBytesFlushedCluster += SealBufferedPages(pages);
+   CommitBufferedPages(pages);
+}
+
 ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
 {
@@ -48,26 +221,32 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHa
    // make sure the page is aware of how many elements it will have
    bufPage.GrowUnchecked(page.GetNElements());
    memcpy(bufPage.GetBuffer(), page.GetBuffer(), page.GetNBytes());
+   fNBytesBuffered += bufPage.GetNBytes();
    // Safety: RColumnBuf::iterators are guaranteed to be valid until the
    // element is destroyed. In other words, all buffered page iterators are
    // valid until the return value of DrainBufferedPages() goes out of scope in
    // CommitCluster().
    RColumnBuf::iterator zipItem =
       fBufferedColumns.at(columnHandle.fId).BufferPage(columnHandle, bufPage);
-   if (!fTaskScheduler) {
-      return RNTupleLocator{};
+   if (fTaskScheduler) {
+      fCounters->fParallelZip.SetValue(1);
+      // Thread safety: Each thread works on a distinct zipItem which owns its
+      // compression buffer.
+      zipItem->AllocateSealedPageBuf();
+      R__ASSERT(zipItem->fBuf);
+      fNBytesBuffered += bufPage.GetNBytes();
+      fTaskScheduler->AddTask([this, zipItem, colId = columnHandle.fId] {
+         zipItem->fSealedPage = SealPage(zipItem->fPage,
+            *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement(),
+            GetWriteOptions().GetCompression(), zipItem->fBuf.get()
+         );
+         zipItem->fSealedPage.fValueRange = GetValueRange(fBufferedColumns.at(colId).GetHandle(), zipItem->fPage);
+      });
    }
-   fCounters->fParallelZip.SetValue(1);
-   // Thread safety: Each thread works on a distinct zipItem which owns its
-   // compression buffer.
-   zipItem->AllocateSealedPageBuf();
-   R__ASSERT(zipItem->fBuf);
-   fTaskScheduler->AddTask([this, zipItem, colId = columnHandle.fId] {
-      zipItem->fSealedPage = SealPage(zipItem->fPage,
-         *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement(),
-         GetWriteOptions().GetCompression(), zipItem->fBuf.get()
-      );
-   });
+
+   const auto budget = GetWriteOptions().GetPageBufferBudget();
+   if (budget > 0 && fNBytesBuffered > budget)
+      FlushBufferedPages();
 
    // we're feeding bad locators to fOpenPageRanges but it should not matter
    // because they never get written out
@@ -78,6 +257,7 @@ ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedPageImpl(
    DescriptorId_t columnId, const RSealedPage &sealedPage)
 {
+   WaitForPendingWrite();
    fInnerSink->CommitSealedPage(columnId, sealedPage);
    // we're feeding bad locators to fOpenPageRanges but it should not matter
    // because they never get written out
@@ -87,28 +267,33 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedPageImpl(
 std::uint64_t
 ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::NTupleSize_t nEntries)
 {
-   if (fTaskScheduler) {
-      fTaskScheduler->Wait();
-      fTaskScheduler->Reset();
-   }
+   WaitForZipTasks();
+   // The inner sink is not thread-safe; only one cluster is written at a time
+   WaitForPendingWrite();
 
-   for (auto &bufColumn : fBufferedColumns) {
-      for (auto &bufPage : bufColumn.DrainBufferedPages()) {
-         if (bufPage.IsSealed()) {
-            fInnerSink->CommitSealedPage(bufColumn.GetHandle().fId, bufPage.fSealedPage);
-         } else {
-            fInnerSink->CommitPage(bufColumn.GetHandle(), bufPage.fPage);
-         }
-         ReleasePage(bufPage.fPage);
-      }
+   auto pages = DrainBufferedPages();
+   if (!GetWriteOptions().GetUseAsyncClusterWrite()) {
+      fNBytesFlushedCluster = 0;
+      CommitBufferedPages(pages);
+      return fInnerSink->CommitCluster(nEntries);
    }
-   return fInnerSink->CommitCluster(nEntries);
+
+   // The compressed cluster size is needed by the caller right away; the pages are sealed here so that the
+   // background thread only performs I/O
+   const std::uint64_t nbytes = fNBytesFlushedCluster + SealBufferedPages(pages);
+   fNBytesFlushedCluster = 0;
+   fPendingWrite = std::async(std::launch::async, [this, nEntries, pages = std::move(pages)]() mutable {
+      CommitBufferedPages(pages);
+      fInnerSink->CommitCluster(nEntries);
+   });
+   return nbytes;
 }
 
 ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterGroupImpl(unsigned char * /* serializedPageList */,
                                                                  std::uint32_t /* length */)
 {
+   WaitForPendingWrite();
    fInnerSink->CommitClusterGroup();
    // We're not using that locator any further, so it is safe to return a dummy one
    return RNTupleLocator{};
@@ -117,6 +302,7 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterGroupImpl(unsigned char *
 void ROOT::Experimental::Detail::RPageSinkBuf::CommitDatasetImpl(unsigned char * /* serializedFooter */,
                                                                  std::uint32_t /* length */)
 {
+   WaitForPendingWrite();
    fInnerSink->CommitDataset();
 }
 
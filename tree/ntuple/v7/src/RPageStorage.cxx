@@ -31,8 +31,81 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
 #include <utility>
 
+namespace {
+
+using RValueRange = ROOT::Experimental::RClusterDescriptor::RValueRange;
+
+/// Computes the minimum and maximum of an in-memory page of values of type T, skipping NaNs
+template <typename T>
+RValueRange ComputeValueRange(const void *buffer, std::size_t nElements)
+{
+   auto values = static_cast<const T *>(buffer);
+   RValueRange range;
+   T min{};
+   T max{};
+   for (std::size_t i = 0; i < nElements; ++i) {
+      const T v = values[i];
+      // NaNs do not satisfy any range predicate and are ignored
+      if (v != v)
+         continue;
+      if (!range.fIsValid) {
+         min = max = v;
+         range.fIsValid = true;
+         continue;
+      }
+      min = std::min(min, v);
+      max = std::max(max, v);
+   }
+   if (!range.fIsValid)
+      return range;
+
+   range.fMin = static_cast<double>(min);
+   range.fMax = static_cast<double>(max);
+   // 64bit integers can be rounded inwards by the conversion to double
+   if (std::is_integral<T>::value && sizeof(T) == 8) {
+      range.fMin = std::nextafter(range.fMin, -std::numeric_limits<double>::infinity());
+      range.fMax = std::nextafter(range.fMax, std::numeric_limits<double>::infinity());
+   }
+   return range;
+}
+
+/// Returns the value range function for the in-memory type of a leaf field, or nullptr if no value ranges are
+/// kept for the type
+RValueRange (*GetValueRangeFunc(const std::string &typeName))(const void *, std::size_t)
+{
+   if (typeName == "float")
+      return ComputeValueRange<float>;
+   if (typeName == "double")
+      return ComputeValueRange<double>;
+   if (typeName == "std::int8_t")
+      return ComputeValueRange<std::int8_t>;
+   if (typeName == "std::uint8_t")
+      return ComputeValueRange<std::uint8_t>;
+   if (typeName == "std::int16_t")
+      return ComputeValueRange<std::int16_t>;
+   if (typeName == "std::uint16_t")
+      return ComputeValueRange<std::uint16_t>;
+   if (typeName == "std::int32_t")
+      return ComputeValueRange<std::int32_t>;
+   if (typeName == "std::uint32_t")
+      return ComputeValueRange<std::uint32_t>;
+   if (typeName == "std::int64_t")
+      return ComputeValueRange<std::int64_t>;
+   if (typeName == "std::uint64_t")
+      return ComputeValueRange<std::uint64_t>;
+   return nullptr;
+}
+
+} // anonymous namespace
+
 
 ROOT::Experimental::Detail::RPageStorage::RPageStorage(std::string_view name) : fNTupleName(name)
 {
@@ -273,6 +346,11 @@ ROOT::Experimental::Detail::RPageSink::AddColumn(DescriptorId_t fieldId, const R
 {
    auto columnId = fDescriptorBuilder.GetDescriptor().GetNColumns();
    fDescriptorBuilder.AddColumn(columnId, fieldId, column.GetModel(), column.GetIndex());
+   fValueRangeFuncs.resize(columnId + 1, nullptr);
+   if (GetWriteOptions().GetUseValueRanges() && column.GetIndex() == 0) {
+      fValueRangeFuncs[columnId] =
+         GetValueRangeFunc(fDescriptorBuilder.GetDescriptor().GetFieldDescriptor(fieldId).GetTypeName());
+   }
    return ColumnHandle_t{columnId, &column};
 }
 
@@ -320,6 +398,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
+   pageInfo.fValueRange = GetValueRange(columnHandle, page);
    pageInfo.fLocator = CommitPageImpl(columnHandle, page);
    fOpenPageRanges.at(columnHandle.fId).fPageInfos.emplace_back(pageInfo);
 }
@@ -333,11 +412,21 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
 
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
+   pageInfo.fValueRange = sealedPage.fValueRange;
    pageInfo.fLocator = CommitSealedPageImpl(columnId, sealedPage);
    fOpenPageRanges.at(columnId).fPageInfos.emplace_back(pageInfo);
 }
 
 
+void ROOT::Experimental::Detail::RPageSink::CommitExistingPage(
+   ROOT::Experimental::DescriptorId_t columnId,
+   const ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo &pageInfo)
+{
+   fOpenColumnRanges.at(columnId).fNElements += pageInfo.fNElements;
+   fOpenPageRanges.at(columnId).fPageInfos.emplace_back(pageInfo);
+}
+
+
 std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NTupleSize_t nEntries)
 {
    auto nbytes = CommitClusterImpl(nEntries);
@@ -429,6 +518,15 @@ ROOT::Experimental::Detail::RPageSink::SealPage(const RPage &page,
    return RSealedPage{pageBuf, zippedBytes, page.GetNElements()};
 }
 
+ROOT::Experimental::RClusterDescriptor::RValueRange
+ROOT::Experimental::Detail::RPageSink::GetValueRange(ColumnHandle_t columnHandle, const RPage &page) const
+{
+   auto valueRangeFunc = fValueRangeFuncs.at(columnHandle.fId);
+   if (!valueRangeFunc)
+      return RClusterDescriptor::RValueRange();
+   return valueRangeFunc(page.GetBuffer(), page.GetNElements());
+}
+
 ROOT::Experimental::Detail::RPageStorage::RSealedPage
 ROOT::Experimental::Detail::RPageSink::SealPage(
    const RPage &page, const RColumnElementBase &element, int compressionSetting)
@@ -386,6 +386,7 @@ void ROOT::Experimental::Detail::RPageSourceDaos::LoadSealedPage(
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
+   sealedPage.fValueRange = pageInfo.fValueRange;
    if (sealedPage.fBuffer) {
       fDaosContainer->ReadSingleAkey(const_cast<void *>(sealedPage.fBuffer), bytesOnStorage,
                                      {static_cast<decltype(daos_obj_id_t::lo)>(pageInfo.fLocator.fPosition), 0},
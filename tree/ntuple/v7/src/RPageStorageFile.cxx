@@ -29,6 +29,7 @@
 
 #include <RVersion.h>
 #include <TError.h>
+#include <TFile.h>
 
 #include <algorithm>
 #include <cstdio>
@@ -232,13 +233,54 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
 }
 
 
+namespace {
+
+/// Gives RRawFile access to an open TFile, for the page sources reading through a TFile
+class RRawFileTFile : public ROOT::Internal::RRawFile {
+private:
+   TFile *fFile;
+
+protected:
+   void OpenImpl() final
+   {
+      // The TFile takes care of buffering
+      if (fOptions.fBlockSize < 0)
+         fOptions.fBlockSize = 0;
+   }
+   size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final
+   {
+      if (fFile->ReadBuffer(static_cast<char *>(buffer), offset, nbytes))
+         return 0;
+      return nbytes;
+   }
+   std::uint64_t GetSizeImpl() final { return fFile->GetSize(); }
+
+public:
+   explicit RRawFileTFile(TFile &file) : RRawFile(file.GetName(), ROptions()), fFile(&file) {}
+   std::unique_ptr<RRawFile> Clone() const final { return std::make_unique<RRawFileTFile>(*fFile); }
+   int GetFeatures() const final { return kFeatureHasSize; }
+};
+
+} // anonymous namespace
+
+
+ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view ntupleName, TFile &file,
+   const RNTuple &anchor, const RNTupleReadOptions &options)
+   : RPageSourceFile(ntupleName, options)
+{
+   fFile = std::make_unique<RRawFileTFile>(file);
+   fReader = Internal::RMiniFileReader(fFile.get());
+   fAnchor = std::make_unique<RNTuple>(anchor);
+}
+
+
 ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile() = default;
 
 
 ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFile::AttachImpl()
 {
    RNTupleDescriptorBuilder descBuilder;
-   auto ntpl = fReader.GetNTuple(fNTupleName).Unwrap();
+   auto ntpl = fAnchor ? *fAnchor : fReader.GetNTuple(fNTupleName).Unwrap();
 
    descBuilder.SetOnDiskHeaderSize(ntpl.fNBytesHeader);
    auto buffer = std::make_unique<unsigned char[]>(ntpl.fLenHeader);
@@ -290,6 +332,7 @@ void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
+   sealedPage.fValueRange = pageInfo.fValueRange;
    if (sealedPage.fBuffer)
       fReader.ReadBuffer(const_cast<void *>(sealedPage.fBuffer), bytesOnStorage, pageInfo.fLocator.fPosition);
 }
@@ -411,6 +454,8 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
    auto clone = new RPageSourceFile(fNTupleName, fOptions);
    clone->fFile = fFile->Clone();
    clone->fReader = Internal::RMiniFileReader(clone->fFile.get());
+   if (fAnchor)
+      clone->fAnchor = std::make_unique<RNTuple>(*fAnchor);
    return std::unique_ptr<RPageSourceFile>(clone);
 }
 
@@ -262,6 +262,74 @@ TEST(RNTuple, PageSize)
    EXPECT_EQ(20, col0_pages.fPageInfos.size());
 }
 
+TEST(RNTuple, ValueRanges)
+{
+   FileRaii fileGuard("test_ntuple_value_ranges.root");
+   auto model = RNTupleModel::Create();
+   auto pt = model->MakeField<float>("pt");
+   auto n = model->MakeField<std::int32_t>("n");
+   auto vec = model->MakeField<std::vector<float>>("vec");
+
+   {
+      RNTupleWriteOptions opt;
+      opt.SetApproxUnzippedPageSize(200);
+      opt.SetUseValueRanges(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 1000; i++) {
+         *pt = i;
+         *n = -i;
+         ntuple->Fill();
+         if (i == 499)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(2u, ntuple->GetDescriptor()->GetNClusters());
+   const auto &clusterDesc = ntuple->GetDescriptor()->GetClusterDescriptor(1);
+   auto columnId = ntuple->GetDescriptor()->FindColumnId(ntuple->GetDescriptor()->FindFieldId("pt"), 0);
+   const auto &columnRange = clusterDesc.GetColumnRange(columnId);
+   EXPECT_TRUE(columnRange.fValueRange.fIsValid);
+   EXPECT_EQ(500., columnRange.fValueRange.fMin);
+   EXPECT_EQ(999., columnRange.fValueRange.fMax);
+
+   // Pages hold 50 elements each
+   auto ranges = ntuple->GetEntryRanges("pt", 510, 560);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(500u, *ranges[0].begin());
+   EXPECT_EQ(600u, *ranges[0].end());
+
+   ranges = ntuple->GetEntryRanges("n", -40, -10);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(0u, *ranges[0].begin());
+   EXPECT_EQ(50u, *ranges[0].end());
+
+   EXPECT_TRUE(ntuple->GetEntryRanges("n", 1, 2).empty());
+   EXPECT_THROW(ntuple->GetEntryRanges("vec", 0, 1), RException);
+   EXPECT_THROW(ntuple->GetEntryRanges("nonexistent", 0, 1), RException);
+}
+
+TEST(RNTuple, ValueRangesDisabled)
+{
+   FileRaii fileGuard("test_ntuple_value_ranges_disabled.root");
+   auto model = RNTupleModel::Create();
+   auto pt = model->MakeField<float>("pt");
+
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 100; i++) {
+         *pt = i;
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   auto ranges = ntuple->GetEntryRanges("pt", 1000, 2000);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(0u, *ranges[0].begin());
+   EXPECT_EQ(100u, *ranges[0].end());
+}
+
 TEST(RNTupleModel, EnforceValidFieldNames)
 {
    auto model = RNTupleModel::Create();
@@ -80,3 +80,219 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+namespace {
+
+std::unique_ptr<RNTupleModel> CreateMergeModel()
+{
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   model->MakeField<std::vector<std::int32_t>>("vec");
+   return model;
+}
+
+// Fills entries [first, first + n) into the ntuple, with a cluster every 1000 entries
+void FillMergeInput(RNTupleWriter &ntuple, int first, int n)
+{
+   auto fldPt = ntuple.GetModel()->Get<float>("pt");
+   auto fldVec = ntuple.GetModel()->Get<std::vector<std::int32_t>>("vec");
+   for (int i = first; i < first + n; ++i) {
+      *fldPt = static_cast<float>(i);
+      *fldVec = std::vector<std::int32_t>(i % 4, i);
+      ntuple.Fill();
+      if ((i - first + 1) % 1000 == 0)
+         ntuple.CommitCluster();
+   }
+}
+
+// Writes entries [first, first + n) with the given compression into the ntuple "ntpl" of the given file
+void WriteMergeInput(const std::string &path, int first, int n, int compression)
+{
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   auto ntuple = RNTupleWriter::Recreate(CreateMergeModel(), "ntpl", path, options);
+   FillMergeInput(*ntuple, first, n);
+}
+
+// Writes entries [first, first + n) into the ntuple "ntpl" of the given open file
+void WriteMergeInput(TFile &file, int first, int n)
+{
+   auto ntuple = RNTupleWriter::Append(CreateMergeModel(), "ntpl", file);
+   FillMergeInput(*ntuple, first, n);
+}
+
+void CheckMergeOutput(const std::string &path, int n)
+{
+   auto ntuple = RNTupleReader::Open("ntpl", path);
+   ASSERT_EQ(static_cast<NTupleSize_t>(n), ntuple->GetNEntries());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewVec = ntuple->GetView<std::vector<std::int32_t>>("vec");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ(std::vector<std::int32_t>(i % 4, i), viewVec(i));
+   }
+}
+
+} // anonymous namespace
+
+TEST(RNTupleMerger, MergeSealedPages)
+{
+   FileRaii fileGuard1("test_ntuple_merge_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_in_2.root");
+   FileRaii fileGuardOut("test_ntuple_merge_out.root");
+   WriteMergeInput(fileGuard1.GetPath(), 0, 2500, 505);
+   // Different compression settings in the second input force the recompression of its pages
+   WriteMergeInput(fileGuard2.GetPath(), 2500, 1500, 0);
+
+   {
+      RPageSourceFile source1("ntpl", fileGuard1.GetPath(), RNTupleReadOptions());
+      RPageSourceFile source2("ntpl", fileGuard2.GetPath(), RNTupleReadOptions());
+      source1.Attach();
+      source2.Attach();
+      std::vector<RPageSource *> sources{&source1, &source2};
+
+      RNTupleWriteOptions options;
+      options.SetCompression(505);
+      RPageSinkFile destination("ntpl", fileGuardOut.GetPath(), options);
+      RNTupleMerger merger;
+      merger.Merge(sources, destination);
+   }
+
+   CheckMergeOutput(fileGuardOut.GetPath(), 4000);
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuardOut.GetPath());
+   EXPECT_EQ(5U, ntuple->GetDescriptor()->GetNClusters());
+   for (const auto &clusterDesc : ntuple->GetDescriptor()->GetClusterIterable()) {
+      for (DescriptorId_t i = 0; i < ntuple->GetDescriptor()->GetNColumns(); ++i)
+         EXPECT_EQ(505, clusterDesc.GetColumnRange(i).fCompressionSettings);
+   }
+}
+
+TEST(RNTupleMerger, MergeIncompatible)
+{
+   FileRaii fileGuard1("test_ntuple_merge_incompatible_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_incompatible_2.root");
+   FileRaii fileGuardOut("test_ntuple_merge_incompatible_out.root");
+   WriteMergeInput(fileGuard1.GetPath(), 0, 10, 505);
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<double>("pt");
+      model->MakeField<std::vector<std::int32_t>>("vec");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard2.GetPath());
+      ntuple->Fill();
+   }
+
+   RPageSourceFile source1("ntpl", fileGuard1.GetPath(), RNTupleReadOptions());
+   RPageSourceFile source2("ntpl", fileGuard2.GetPath(), RNTupleReadOptions());
+   source1.Attach();
+   source2.Attach();
+   std::vector<RPageSource *> sources{&source1, &source2};
+   RPageSinkFile destination("ntpl", fileGuardOut.GetPath(), RNTupleWriteOptions());
+   RNTupleMerger merger;
+   EXPECT_THROW(merger.Merge(sources, destination), RException);
+}
+
+TEST(RNTupleMerger, FileMerger)
+{
+   FileRaii fileGuard1("test_ntuple_filemerger_in_1.root");
+   FileRaii fileGuard2("test_ntuple_filemerger_in_2.root");
+   FileRaii fileGuardOut("test_ntuple_filemerger_out.root");
+   WriteMergeInput(fileGuard1.GetPath(), 0, 1200, 505);
+   WriteMergeInput(fileGuard2.GetPath(), 1200, 800, 505);
+
+   {
+      TFileMerger fileMerger(kFALSE, kFALSE);
+      fileMerger.OutputFile(fileGuardOut.GetPath().c_str(), "RECREATE");
+      fileMerger.AddFile(fileGuard1.GetPath().c_str());
+      fileMerger.AddFile(fileGuard2.GetPath().c_str());
+      EXPECT_TRUE(fileMerger.Merge());
+   }
+
+   CheckMergeOutput(fileGuardOut.GetPath(), 2000);
+}
+
+TEST(RNTupleMerger, FileMergerMemFile)
+{
+   FileRaii fileGuardOut("test_ntuple_filemerger_memfile_out.root");
+   TMemFile input1("test_ntuple_filemerger_memfile_in_1.root", "RECREATE");
+   TMemFile input2("test_ntuple_filemerger_memfile_in_2.root", "RECREATE");
+   TMemFile input3("test_ntuple_filemerger_memfile_in_3.root", "RECREATE");
+   WriteMergeInput(input1, 0, 1200);
+   // The second input has no ntuple and is skipped
+   std::string str("no ntuple");
+   input2.WriteObject(&str, "str");
+   WriteMergeInput(input3, 1200, 800);
+
+   {
+      TFileMerger fileMerger(kFALSE, kFALSE);
+      fileMerger.OutputFile(fileGuardOut.GetPath().c_str(), "RECREATE");
+      fileMerger.AddFile(&input1, kFALSE);
+      fileMerger.AddFile(&input2, kFALSE);
+      fileMerger.AddFile(&input3, kFALSE);
+      EXPECT_TRUE(fileMerger.Merge());
+   }
+
+   CheckMergeOutput(fileGuardOut.GetPath(), 2000);
+}
+
+TEST(RNTupleMerger, FileMergerIncremental)
+{
+   FileRaii fileGuard1("test_ntuple_filemerger_incremental_in_1.root");
+   FileRaii fileGuard2("test_ntuple_filemerger_incremental_in_2.root");
+   FileRaii fileGuardOut("test_ntuple_filemerger_incremental_out.root");
+   WriteMergeInput(fileGuard1.GetPath(), 0, 1200, 505);
+   WriteMergeInput(fileGuard2.GetPath(), 1200, 800, 505);
+
+   {
+      TFileMerger fileMerger(kFALSE, kFALSE);
+      fileMerger.OutputFile(fileGuardOut.GetPath().c_str(), "RECREATE");
+      fileMerger.AddFile(fileGuard1.GetPath().c_str());
+      EXPECT_TRUE(fileMerger.PartialMerge(TFileMerger::kAllIncremental));
+      // The entries already in the output file are kept
+      fileMerger.AddFile(fileGuard2.GetPath().c_str());
+      EXPECT_TRUE(fileMerger.PartialMerge(TFileMerger::kAllIncremental));
+   }
+
+   CheckMergeOutput(fileGuardOut.GetPath(), 2000);
+   auto file = std::unique_ptr<TFile>(TFile::Open(fileGuardOut.GetPath().c_str()));
+   // Only the anchor of the merged ntuple is left
+   EXPECT_EQ(1, file->GetListOfKeys()->GetEntries());
+}
+
+TEST(RNTupleMerger, FileMergerIncrementalInPlace)
+{
+   const int nInputs = 5;
+   FileRaii fileGuardFirst("test_ntuple_filemerger_inplace_in_first.root");
+   std::vector<std::unique_ptr<FileRaii>> fileGuards;
+   FileRaii fileGuardOut("test_ntuple_filemerger_inplace_out.root");
+   WriteMergeInput(fileGuardFirst.GetPath(), 0, 20000, 0);
+   for (int i = 0; i < nInputs; ++i) {
+      fileGuards.emplace_back(
+         std::make_unique<FileRaii>("test_ntuple_filemerger_inplace_in_" + std::to_string(i) + ".root"));
+      WriteMergeInput(fileGuards.back()->GetPath(), 20000 + i, 1, 0);
+   }
+
+   auto getFileSize = [&fileGuardOut]() {
+      auto file = std::unique_ptr<TFile>(TFile::Open(fileGuardOut.GetPath().c_str()));
+      return file->GetSize();
+   };
+
+   {
+      TFileMerger fileMerger(kFALSE, kFALSE);
+      fileMerger.OutputFile(fileGuardOut.GetPath().c_str(), "RECREATE");
+      fileMerger.AddFile(fileGuardFirst.GetPath().c_str());
+      EXPECT_TRUE(fileMerger.PartialMerge(TFileMerger::kAllIncremental));
+   }
+   const auto sizeFirst = getFileSize();
+
+   for (int i = 0; i < nInputs; ++i) {
+      TFileMerger fileMerger(kFALSE, kFALSE);
+      fileMerger.OutputFile(fileGuardOut.GetPath().c_str(), "UPDATE");
+      fileMerger.AddFile(fileGuards[i]->GetPath().c_str());
+      EXPECT_TRUE(fileMerger.PartialMerge(TFileMerger::kAllIncremental));
+   }
+
+   CheckMergeOutput(fileGuardOut.GetPath(), 20000 + nInputs);
+   // The pages already in the output file are not written again and the replaced meta-data is released, so the
+   // incremental merges grow the file by much less than the uncompressed 20000 floats of the first input
+   EXPECT_LT(getFileSize(), sizeFirst + 20000 * sizeof(float) / 2);
+}
@@ -32,3 +32,156 @@ TEST(Packing, Bitfield)
       EXPECT_EQ(b9[i], e9[i]);
    }
 }
+
+TEST(Packing, SplitReal)
+{
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64> element(nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   // More than one encoding block
+   std::vector<double> values;
+   for (unsigned i = 0; i < 1000; ++i)
+      values.push_back(0.5 * i - 100.);
+   std::vector<unsigned char> packed(element.GetPackedSize(values.size()));
+   element.Pack(packed.data(), values.data(), values.size());
+   std::vector<double> unpacked(values.size());
+   element.Unpack(unpacked.data(), packed.data(), values.size());
+   EXPECT_EQ(values, unpacked);
+
+   // The most significant byte of 2.0 (0x4000000000000000) is the last byte plane
+   double two = 2.0;
+   unsigned char twoPacked[8];
+   element.Pack(twoPacked, &two, 1);
+   EXPECT_EQ(0x40, twoPacked[7]);
+}
+
+TEST(Packing, SplitInt)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32> element(
+      nullptr);
+
+   // Zigzag encoding maps small magnitudes to small unsigned values
+   std::int32_t values[] = {0, -1, 1, -2, std::numeric_limits<std::int32_t>::min(),
+                            std::numeric_limits<std::int32_t>::max()};
+   unsigned char packed[sizeof(values)];
+   element.Pack(packed, values, 6);
+   EXPECT_EQ(0, packed[0]);
+   EXPECT_EQ(1, packed[1]);
+   EXPECT_EQ(2, packed[2]);
+   EXPECT_EQ(3, packed[3]);
+   std::int32_t unpacked[6];
+   element.Unpack(unpacked, packed, 6);
+   for (unsigned i = 0; i < 6; ++i)
+      EXPECT_EQ(values[i], unpacked[i]);
+
+   ROOT::Experimental::Detail::RColumnElement<std::uint16_t, ROOT::Experimental::EColumnType::kSplitInt16>
+      elementU16(nullptr);
+   std::uint16_t valuesU16[] = {0, 1, 42, std::numeric_limits<std::uint16_t>::max()};
+   unsigned char packedU16[sizeof(valuesU16)];
+   elementU16.Pack(packedU16, valuesU16, 4);
+   std::uint16_t unpackedU16[4];
+   elementU16.Unpack(unpackedU16, packedU16, 4);
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(valuesU16[i], unpackedU16[i]);
+
+   ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt32>
+      elementNarrow(nullptr);
+   EXPECT_EQ(32u, elementNarrow.GetBitsOnStorage());
+   std::int64_t valuesNarrow[] = {-5, 7, std::numeric_limits<std::int32_t>::min()};
+   std::int32_t packedNarrow[3];
+   elementNarrow.Pack(packedNarrow, valuesNarrow, 3);
+   std::int64_t unpackedNarrow[3];
+   elementNarrow.Unpack(unpackedNarrow, packedNarrow, 3);
+   for (unsigned i = 0; i < 3; ++i)
+      EXPECT_EQ(valuesNarrow[i], unpackedNarrow[i]);
+}
+
+TEST(Packing, SplitIndex)
+{
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex32> element(
+      nullptr);
+
+   std::vector<ClusterSize_t> offsets;
+   ClusterSize_t::ValueType offset = 1000;
+   for (unsigned i = 0; i < 300; ++i) {
+      offset += i % 5;
+      offsets.push_back(ClusterSize_t(offset));
+   }
+   std::vector<std::uint32_t> packed(offsets.size());
+   element.Pack(packed.data(), offsets.data(), offsets.size());
+   // First element stored as is, following elements as deltas: only the least significant byte plane is non-zero
+   auto bytes = reinterpret_cast<unsigned char *>(packed.data());
+   EXPECT_EQ(1000 % 256, bytes[0]);
+   EXPECT_EQ(1000 / 256, bytes[offsets.size()]);
+   for (unsigned i = 1; i < offsets.size(); ++i) {
+      EXPECT_EQ(i % 5, bytes[i]);
+      EXPECT_EQ(0, bytes[offsets.size() + i]);
+   }
+
+   std::vector<ClusterSize_t> unpacked(offsets.size());
+   element.Unpack(unpacked.data(), packed.data(), offsets.size());
+   for (unsigned i = 0; i < offsets.size(); ++i)
+      EXPECT_EQ(offsets[i], unpacked[i]);
+}
+
+TEST(Packing, SplitEncoding)
+{
+   FileRaii fileGuard("test_ntuple_packing_split.root");
+
+   auto model = RNTupleModel::Create();
+   auto fldPt = model->MakeField<float>("pt");
+   auto fldE = model->MakeField<double>("E");
+   auto fldCharge = model->MakeField<std::int32_t>("charge");
+   auto fldRun = model->MakeField<std::uint64_t>("run");
+   auto fldTracks = model->MakeField<std::vector<float>>("tracks");
+   auto fldTag = model->MakeField<std::string>("tag");
+   {
+      RNTupleWriteOptions options;
+      options.SetUseSplitEncoding(true);
+      options.SetUseSplitEncoding("E", false);
+      options.SetApproxUnzippedPageSize(256);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (unsigned i = 0; i < 500; ++i) {
+         *fldPt = 1.5 * i;
+         *fldE = -2.5 * i;
+         *fldCharge = static_cast<std::int32_t>(i % 3) - 1;
+         *fldRun = 300000 + i / 10;
+         fldTracks->assign(i % 4, 0.5 * i);
+         *fldTag = std::string(i % 3, 'x');
+         writer->Fill();
+         if (i == 250)
+            writer->CommitCluster();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   const auto desc = reader->GetDescriptor();
+   auto fnColumnType = [&desc](const std::string &fieldName, DescriptorId_t parentId) {
+      auto fieldId = desc->FindFieldId(fieldName, parentId);
+      return desc->GetColumnDescriptor(desc->FindColumnId(fieldId, 0)).GetModel().GetType();
+   };
+   const auto zeroId = desc->GetFieldZeroId();
+   EXPECT_EQ(EColumnType::kSplitReal32, fnColumnType("pt", zeroId));
+   EXPECT_EQ(EColumnType::kReal64, fnColumnType("E", zeroId));
+   EXPECT_EQ(EColumnType::kSplitInt32, fnColumnType("charge", zeroId));
+   EXPECT_EQ(EColumnType::kSplitInt64, fnColumnType("run", zeroId));
+   EXPECT_EQ(EColumnType::kSplitIndex32, fnColumnType("tracks", zeroId));
+   EXPECT_EQ(EColumnType::kSplitReal32, fnColumnType("_0", desc->FindFieldId("tracks")));
+   EXPECT_EQ(EColumnType::kSplitIndex32, fnColumnType("tag", zeroId));
+
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewE = reader->GetView<double>("E");
+   auto viewCharge = reader->GetView<std::int32_t>("charge");
+   auto viewRun = reader->GetView<std::uint64_t>("run");
+   auto viewTracks = reader->GetView<std::vector<float>>("tracks");
+   auto viewTag = reader->GetView<std::string>("tag");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(1.5 * i, viewPt(i));
+      EXPECT_DOUBLE_EQ(-2.5 * i, viewE(i));
+      EXPECT_EQ(static_cast<std::int32_t>(i % 3) - 1, viewCharge(i));
+      EXPECT_EQ(300000 + i / 10, viewRun(i));
+      EXPECT_EQ(std::vector<float>(i % 4, 0.5 * i), viewTracks(i));
+      EXPECT_EQ(std::string(i % 3, 'x'), viewTag(i));
+   }
+}
@@ -597,3 +597,101 @@ TEST(RNTuple, SerializeFooter)
    EXPECT_EQ(100u, pageRange.fPageInfos[0].fNElements);
    EXPECT_EQ(7000u, pageRange.fPageInfos[0].fLocator.fPosition);
 }
+
+TEST(RNTuple, SerializePageListValueRanges)
+{
+   RNTupleDescriptorBuilder builder;
+   builder.SetNTuple("ntpl", "");
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(0).FieldName("").Structure(ENTupleStructure::kRecord).MakeDescriptor().Unwrap());
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(42).FieldName("pt").Structure(ENTupleStructure::kLeaf).MakeDescriptor().Unwrap());
+   builder.AddFieldLink(0, 42);
+   builder.AddColumn(17, 42, RColumnModel(EColumnType::kReal32, false), 0);
+   builder.AddField(
+      RFieldDescriptorBuilder().FieldId(43).FieldName("id").Structure(ENTupleStructure::kLeaf).MakeDescriptor().Unwrap());
+   builder.AddFieldLink(0, 43);
+   builder.AddColumn(18, 43, RColumnModel(EColumnType::kInt32, false), 0);
+
+   RClusterDescriptorBuilder clusterBuilder(84, 0, 100);
+   ROOT::Experimental::RClusterDescriptor::RPageRange pageRange;
+   ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+   pageRange.fColumnId = 17;
+   pageInfo.fNElements = 60;
+   pageInfo.fLocator.fPosition = 7000;
+   pageInfo.fValueRange.fMin = -1.5;
+   pageInfo.fValueRange.fMax = 3.0;
+   pageInfo.fValueRange.fIsValid = true;
+   pageRange.fPageInfos.emplace_back(pageInfo);
+   pageInfo.fNElements = 40;
+   pageInfo.fLocator.fPosition = 8000;
+   pageInfo.fValueRange.fMin = 2.0;
+   pageInfo.fValueRange.fMax = 8.5;
+   pageRange.fPageInfos.emplace_back(pageInfo);
+   clusterBuilder.CommitColumnRange(17, 0, 100, pageRange);
+   // Without value ranges
+   pageRange.fColumnId = 18;
+   pageRange.fPageInfos.clear();
+   pageInfo.fNElements = 100;
+   pageInfo.fLocator.fPosition = 9000;
+   pageInfo.fValueRange = ROOT::Experimental::RClusterDescriptor::RValueRange();
+   pageRange.fPageInfos.emplace_back(pageInfo);
+   clusterBuilder.CommitColumnRange(18, 0, 100, pageRange);
+   builder.AddClusterWithDetails(clusterBuilder.MoveDescriptor().Unwrap());
+   RClusterGroupDescriptorBuilder cgBuilder;
+   cgBuilder.ClusterGroupId(256).PageListLength(137).PageListLocator(RNTupleLocator());
+   cgBuilder.AddCluster(84);
+   builder.AddClusterGroup(std::move(cgBuilder));
+
+   auto desc = builder.MoveDescriptor();
+   const auto &columnRange = desc.GetClusterDescriptor(84).GetColumnRange(17);
+   EXPECT_TRUE(columnRange.fValueRange.fIsValid);
+   EXPECT_EQ(-1.5, columnRange.fValueRange.fMin);
+   EXPECT_EQ(8.5, columnRange.fValueRange.fMax);
+   EXPECT_FALSE(desc.GetClusterDescriptor(84).GetColumnRange(18).fValueRange.fIsValid);
+
+   auto context = RNTupleSerializer::SerializeHeaderV1(nullptr, desc);
+   auto bufHeader = std::make_unique<unsigned char[]>(context.GetHeaderSize());
+   context = RNTupleSerializer::SerializeHeaderV1(bufHeader.get(), desc);
+   std::vector<DescriptorId_t> physClusterIDs{context.MapClusterId(84)};
+   context.MapClusterGroupId(256);
+
+   auto sizePageList = RNTupleSerializer::SerializePageListV1(nullptr, desc, physClusterIDs, context);
+   auto bufPageList = std::make_unique<unsigned char[]>(sizePageList);
+   EXPECT_EQ(sizePageList, RNTupleSerializer::SerializePageListV1(bufPageList.get(), desc, physClusterIDs, context));
+   auto sizeFooter = RNTupleSerializer::SerializeFooterV1(nullptr, desc, context);
+   auto bufFooter = std::make_unique<unsigned char[]>(sizeFooter);
+   RNTupleSerializer::SerializeFooterV1(bufFooter.get(), desc, context);
+
+   RNTupleSerializer::DeserializeHeaderV1(bufHeader.get(), context.GetHeaderSize(), builder);
+   RNTupleSerializer::DeserializeFooterV1(bufFooter.get(), sizeFooter, builder);
+   desc = builder.MoveDescriptor();
+   std::vector<RClusterDescriptorBuilder> clusters = RClusterGroupDescriptorBuilder::GetClusterSummaries(desc, 0);
+   RNTupleSerializer::DeserializePageListV1(bufPageList.get(), sizePageList, clusters).ThrowOnError();
+   desc.AddClusterDetails(clusters[0].MoveDescriptor().Unwrap());
+
+   const auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+   const auto idColumnId = desc.FindColumnId(desc.FindFieldId("id"), 0);
+   const auto &clusterDesc = desc.GetClusterDescriptor(0);
+   const auto &pageInfos = clusterDesc.GetPageRange(ptColumnId).fPageInfos;
+   ASSERT_EQ(2u, pageInfos.size());
+   EXPECT_TRUE(pageInfos[0].fValueRange.fIsValid);
+   EXPECT_EQ(-1.5, pageInfos[0].fValueRange.fMin);
+   EXPECT_EQ(3.0, pageInfos[0].fValueRange.fMax);
+   EXPECT_EQ(2.0, pageInfos[1].fValueRange.fMin);
+   EXPECT_EQ(8.5, pageInfos[1].fValueRange.fMax);
+   EXPECT_EQ(-1.5, clusterDesc.GetColumnRange(ptColumnId).fValueRange.fMin);
+   EXPECT_EQ(8.5, clusterDesc.GetColumnRange(ptColumnId).fValueRange.fMax);
+   EXPECT_FALSE(clusterDesc.GetPageRange(idColumnId).fPageInfos[0].fValueRange.fIsValid);
+   EXPECT_FALSE(clusterDesc.GetColumnRange(idColumnId).fValueRange.fIsValid);
+
+   auto ranges = desc.FindEntryRanges(desc.FindFieldId("pt"), 5, 6);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(60u, ranges[0].first);
+   EXPECT_EQ(100u, ranges[0].second);
+   EXPECT_TRUE(desc.FindEntryRanges(desc.FindFieldId("pt"), 10, 20).empty());
+   ranges = desc.FindEntryRanges(desc.FindFieldId("id"), 10, 20);
+   ASSERT_EQ(1u, ranges.size());
+   EXPECT_EQ(0u, ranges[0].first);
+   EXPECT_EQ(100u, ranges[0].second);
+}
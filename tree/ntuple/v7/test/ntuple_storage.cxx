@@ -319,6 +319,61 @@ TEST(RPageSinkBuf, Basics)
    }
 }
 
+TEST(RPageSinkBuf, ZipThreadsAsyncWrite)
+{
+   FileRaii fileGuard("test_ntuple_sinkbuf_zipthreads.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto floatField = model->MakeField<float>("pt");
+      auto fieldKlassVec = model->MakeField<std::vector<CustomStruct>>("klassVec");
+      RNTupleWriteOptions options;
+      options.SetZipThreads(2);
+      options.SetUseAsyncClusterWrite(true);
+      // Small enough to force several early page flushes per cluster
+      options.SetPageBufferBudget(64 * 1024);
+      auto ntuple = std::make_unique<RNTupleWriter>(std::move(model),
+         std::make_unique<RPageSinkBuf>(std::make_unique<RPageSinkFile>(
+            "buf_zipthreads", fileGuard.GetPath(), options
+      )));
+      ntuple->EnableMetrics();
+      for (int i = 0; i < 40000; i++) {
+         *floatField = static_cast<float>(i);
+         CustomStruct klass;
+         klass.a = 42.0;
+         klass.v1.emplace_back(static_cast<float>(i));
+         klass.v2.emplace_back(std::vector<float>(3, static_cast<float>(i)));
+         klass.s = "hi" + std::to_string(i);
+         *fieldKlassVec = std::vector<CustomStruct>{klass};
+         ntuple->Fill();
+         if (i && i % 10000 == 0)
+            ntuple->CommitCluster();
+      }
+      auto *parallel_zip = ntuple->GetMetrics().GetCounter("RNTupleWriter.RPageSinkBuf.ParallelZip");
+      ASSERT_FALSE(parallel_zip == nullptr);
+      EXPECT_EQ(1, parallel_zip->GetValueAsInt());
+      auto *async_write = ntuple->GetMetrics().GetCounter("RNTupleWriter.RPageSinkBuf.AsyncClusterWrite");
+      ASSERT_FALSE(async_write == nullptr);
+      EXPECT_EQ(1, async_write->GetValueAsInt());
+      auto *n_flush = ntuple->GetMetrics().GetCounter("RNTupleWriter.RPageSinkBuf.nFlushBudget");
+      ASSERT_FALSE(n_flush == nullptr);
+      EXPECT_GT(n_flush->GetValueAsInt(), 0);
+   }
+
+   auto ntuple = RNTupleReader::Open("buf_zipthreads", fileGuard.GetPath());
+   EXPECT_EQ(40000, ntuple->GetNEntries());
+   EXPECT_EQ(4U, ntuple->GetDescriptor()->GetNClusters());
+
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewKlassVec = ntuple->GetView<std::vector<CustomStruct>>("klassVec");
+   for (auto i : ntuple->GetEntryRange()) {
+      float fi = static_cast<float>(i);
+      EXPECT_EQ(fi, viewPt(i));
+      EXPECT_EQ(std::vector<float>{fi}, viewKlassVec(i).at(0).v1);
+      EXPECT_EQ((std::vector<float>(3, fi)), viewKlassVec(i).at(0).v2.at(0));
+      EXPECT_EQ("hi" + std::to_string(i), viewKlassVec(i).at(0).s);
+   }
+}
+
 TEST(RPageSinkBuf, ParallelZip) {
    ROOT::EnableImplicitMT();
 
@@ -365,6 +420,69 @@ TEST(RPageSinkBuf, ParallelZip) {
    }
 }
 
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer.root");
+   constexpr int kNThreads = 4;
+   constexpr int kNEntriesPerThread = 10000;
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      model->MakeField<std::vector<float>>("vec");
+
+      auto frozenModel = model->Clone();
+      frozenModel->Freeze();
+      EXPECT_THROW(RNTupleParallelWriter::Recreate(std::move(frozenModel), "ntpl", fileGuard.GetPath()),
+                   RException);
+
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+
+      auto context1 = writer->CreateFillContext();
+      auto context2 = writer->CreateFillContext();
+      auto foreignEntry = context1->CreateEntry();
+      EXPECT_THROW(context2->Fill(*foreignEntry), RException);
+      context1.reset();
+      context2.reset();
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t] {
+            auto context = writer->CreateFillContext();
+            auto entry = context->CreateEntry();
+            auto pt = entry->Get<float>("pt");
+            auto vec = entry->Get<std::vector<float>>("vec");
+            for (int i = 0; i < kNEntriesPerThread; ++i) {
+               *pt = static_cast<float>(t * kNEntriesPerThread + i);
+               *vec = std::vector<float>(i % 3, *pt);
+               context->Fill(*entry);
+               if ((i + 1) % 2500 == 0)
+                  context->CommitCluster();
+            }
+         });
+      }
+      for (auto &t : threads)
+         t.join();
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), ntuple->GetNEntries());
+   EXPECT_EQ(static_cast<std::size_t>(kNThreads * kNEntriesPerThread / 2500),
+             ntuple->GetDescriptor()->GetNClusters());
+
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewVec = ntuple->GetView<std::vector<float>>("vec");
+   std::vector<bool> seen(kNThreads * kNEntriesPerThread, false);
+   for (auto i : ntuple->GetEntryRange()) {
+      auto pt = viewPt(i);
+      auto idx = static_cast<int>(pt);
+      ASSERT_GE(idx, 0);
+      ASSERT_LT(idx, kNThreads * kNEntriesPerThread);
+      EXPECT_FALSE(seen[idx]);
+      seen[idx] = true;
+      EXPECT_EQ(std::vector<float>((idx % kNEntriesPerThread) % 3, pt), viewVec(i));
+   }
+}
+
 TEST(RPageSink, Empty)
 {
    FileRaii fileGuard("test_ntuple_empty.ntuple");
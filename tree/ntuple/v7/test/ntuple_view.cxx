@@ -132,6 +132,94 @@ TEST(RNTuple, BulkViewCollection)
    }
 }
 
+TEST(RNTuple, ReadBulk)
+{
+   FileRaii fileGuard("test_ntuple_read_bulk.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldTag = model->MakeField<std::string>("tag");
+   auto fieldVec = model->MakeField<std::vector<double>>("vec");
+   {
+      RNTupleWriteOptions opt;
+      opt.SetApproxUnzippedPageSize(64);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 100; i++) {
+         *fieldPt = i;
+         *fieldTag = std::to_string(i);
+         *fieldVec = std::vector<double>(i % 3, i);
+         ntuple->Fill();
+         if (i == 49)
+            ntuple->CommitCluster();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   EXPECT_EQ(2u, ntuple->GetDescriptor()->GetNClusters());
+
+   // Spans several pages and both clusters
+   auto viewPt = ntuple->GetView<float>("pt");
+   std::vector<float> pt(80);
+   viewPt.ReadBulk(10, pt.size(), pt.data());
+   for (unsigned i = 0; i < pt.size(); ++i)
+      EXPECT_EQ(float(10 + i), pt[i]);
+
+   auto viewTag = ntuple->GetView<std::string>("tag");
+   std::vector<std::string> tag(80);
+   viewTag.ReadBulk(10, tag.size(), tag.data());
+   for (unsigned i = 0; i < tag.size(); ++i)
+      EXPECT_EQ(std::to_string(10 + i), tag[i]);
+
+   auto viewVec = ntuple->GetViewCollection("vec");
+   auto viewVecItems = viewVec.GetView<double>("_0");
+   std::vector<NTupleSize_t> offsets(81);
+   viewVec.ReadOffsetsBulk(10, 80, offsets.data());
+   std::vector<double> items(offsets[80] - offsets[0]);
+   viewVecItems.ReadBulk(offsets[0], items.size(), items.data());
+   for (unsigned i = 0; i < 80; ++i) {
+      const auto entry = 10 + i;
+      ASSERT_EQ(entry % 3, offsets[i + 1] - offsets[i]);
+      for (auto j = offsets[i]; j < offsets[i + 1]; ++j)
+         EXPECT_EQ(double(entry), items[j - offsets[0]]);
+   }
+}
+
+TEST(RNTuple, ReadOffsetsBulkArrayItems)
+{
+   FileRaii fileGuard("test_ntuple_read_offsets_bulk_array.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldVec = model->MakeField<std::vector<std::array<float, 3>>>("vec");
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      for (int i = 0; i < 90; i++) {
+         fieldVec->clear();
+         for (int j = 0; j < i % 4; ++j)
+            fieldVec->push_back({float(i), float(j), float(i + j)});
+         ntuple->Fill();
+         if (i % 30 == 29)
+            ntuple->CommitCluster();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   EXPECT_EQ(3u, ntuple->GetDescriptor()->GetNClusters());
+
+   // The item column of the collection is the one of the array items, with three elements per collection item
+   auto viewVec = ntuple->GetViewCollection("vec");
+   auto viewVecItems = viewVec.GetView<std::array<float, 3>>("_0");
+   std::vector<NTupleSize_t> offsets(91);
+   viewVec.ReadOffsetsBulk(0, 90, offsets.data());
+   EXPECT_EQ(0u, offsets[0]);
+   std::vector<std::array<float, 3>> items(offsets[90]);
+   viewVecItems.ReadBulk(0, items.size(), items.data());
+   for (unsigned i = 0; i < 90; ++i) {
+      ASSERT_EQ(i % 4, offsets[i + 1] - offsets[i]);
+      for (auto j = offsets[i]; j < offsets[i + 1]; ++j) {
+         const float k = j - offsets[i];
+         EXPECT_EQ((std::array<float, 3>{float(i), k, i + k}), items[j]);
+      }
+   }
+}
+
 TEST(RNTuple, Composable)
 {
    FileRaii fileGuard("test_ntuple_composable.root");
@@ -31,6 +31,8 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <vector>
+
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -143,12 +145,16 @@ protected:
    char       *fAddress;          ///<! Address of 1st leaf (variable or object)
    TDirectory *fDirectory;        ///<! Pointer to directory where this branch buffers are stored
    TString     fFileName;         ///<  Name of file where buffers are stored ("" if in same file as Tree header)
+   std::vector<char> fCompressionDictionary; ///<  zstd dictionary used for the baskets (see ROOT::Experimental::EIOFeatures::kZstdDictionary)
    TBuffer    *fEntryBuffer;      ///<! Buffer used to directly pass the content without streaming
    TBuffer    *fTransientBuffer;  ///<! Pointer to the current transient buffer.
    TList      *fBrowsables;       ///<! List of TVirtualBranchBrowsables used for Browse()
    BulkObj     fBulk;             ///<! Helper for performing bulk IO
 
    Bool_t      fSkipZip;          ///<! After being read, the buffer will not be unzipped.
+   Bool_t      fDictionaryTrained; ///<! True once the training of fCompressionDictionary was attempted.
+   std::vector<char>   fDictionarySamples;     ///<! Content of the baskets collected to train fCompressionDictionary.
+   std::vector<size_t> fDictionarySampleSizes; ///<! Size of each sample in fDictionarySamples.
 
    using CacheInfo_t = ROOT::Internal::TBranchCacheInfo;
    CacheInfo_t fCacheInfo;        ///<! Hold info about which basket are in the cache and if they have been retrieved from the cache.
@@ -238,6 +244,7 @@ public:
            Long64_t  GetEntryNumber() const {return fEntryNumber;}
            Long64_t  GetFirstEntry()  const {return fFirstEntry; }
          TIOFeatures GetIOFeatures() const;
+   const std::vector<char> &GetCompressionDictionary() const { return fCompressionDictionary; }
          TObjArray  *GetListOfBaskets()  {return &fBaskets;}
          TObjArray  *GetListOfBranches() {return &fBranches;}
          TObjArray  *GetListOfLeaves()   {return &fLeaves;}
@@ -285,10 +292,11 @@ public:
            Bool_t    SupportsBulkRead() const;
    virtual void      UpdateAddress() {;}
    virtual void      UpdateFile();
+   const std::vector<char> *PrepareCompressionDictionary(const char *basketData, Int_t len);
 
    static  void      ResetCount();
 
-   ClassDef(TBranch, 13); // Branch descriptor
+   ClassDef(TBranch, 14); // Branch descriptor
 };
 
 //______________________________________________________________________________
@@ -133,6 +133,14 @@ public:
    static Bool_t        IsParallelUnzip();
    static Int_t         SetParallelUnzip(TTreeCacheUnzip::EParUnzipMode option = TTreeCacheUnzip::kEnable);
 
+   // Methods related to the process-wide cache of unzipped baskets
+   static Long64_t      GetSharedCacheSize();
+   static void          SetSharedCacheSize(Long64_t maxBytes);
+   static Bool_t        GetSharedUnzipBuffer(TFile *file, Long64_t pos, Int_t len, char *&buf, Int_t &size);
+   static void          AddSharedUnzipBuffer(TFile *file, Long64_t pos, Int_t len, const char *buf, Int_t size);
+   static Long64_t      GetNSharedFound();
+   static Long64_t      GetNSharedMissed();
+
    // Unzipping related methods
 #ifdef R__USE_IMT
    Int_t          CreateTasks();
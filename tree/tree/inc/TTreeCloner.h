@@ -28,6 +28,12 @@ class TFile;
 class TFileCacheRead;
 class TDirectory;
 
+namespace ROOT {
+namespace Internal {
+class TTreeClonerReadAhead;
+}
+}
+
 class TTreeCloner {
    TString    fWarningMsg;       ///< Text of the error message lead to an 'invalid' state
 
@@ -59,6 +65,9 @@ class TTreeCloner {
    TFileCacheRead *fFileCache;   ///< File Cache used to reduce the number of individual reads
    TFileCacheRead *fPrevCache;   ///< Cache that set before the TTreeCloner ctor for the 'from' TTree if any.
 
+   ROOT::Internal::TTreeClonerReadAhead *fReadAhead; ///<! Provider of the baskets loaded ahead of the cloning, if any.
+   UInt_t          fReadAheadInput; ///<! Index of the 'from' TTree in fReadAhead.
+
    enum ECloneMethod {
       kDefault             = 0,
       kSortBasketsByBranch = 1,
@@ -87,6 +96,7 @@ class TTreeCloner {
    void CreateCache();
    UInt_t FillCache(UInt_t from);
    void RestoreCache();
+   void WriteBasketsWithReadAhead();
 
 private:
    TTreeCloner(const TTreeCloner&) = delete;
@@ -120,6 +130,7 @@ public:
    Bool_t IsValid() { return fIsValid; }
    Bool_t NeedConversion() { return fNeedConversion; }
    void   SetCacheSize(Int_t size);
+   void   SetReadAhead(ROOT::Internal::TTreeClonerReadAhead *readAhead, UInt_t input);
    void   SortBaskets();
    void   WriteBaskets();
 
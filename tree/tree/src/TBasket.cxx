@@ -20,6 +20,7 @@
 #include "TMath.h"
 #include "TROOT.h"
 #include "TTreeCache.h"
+#include "TTreeCacheUnzip.h"
 #include "TVirtualMutex.h"
 #include "TVirtualPerfStats.h"
 #include "TTimeStamp.h"
@@ -469,7 +470,9 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
 
    Bool_t oldCase;
    char *rawUncompressedBuffer, *rawCompressedBuffer;
+   const char *mappedBuffer;
    Int_t uncompressedBufferLen;
+   const Int_t recordLen = len; // len is reused for the unzipped length below
 
    // See if the cache has already unzipped the buffer for us.
    TFileCacheRead *pf = nullptr;
@@ -477,6 +480,16 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       R__LOCKGUARD_IMT(gROOTMutex); // Lock for parallel TTree I/O
       pf = fBranch->GetTree()->GetReadCache(file);
    }
+   // See if another tree of this process has already unzipped the buffer for us.
+   if (R__unlikely(TTreeCacheUnzip::GetSharedCacheSize() > 0)) {
+      char *buffer = nullptr;
+      Int_t size = 0;
+      if (TTreeCacheUnzip::GetSharedUnzipBuffer(file, pos, len, buffer, size)) {
+         len = ReadBasketBuffersUnzip(buffer, size, kTRUE, file);
+         if (len <= 0) return -len;
+         goto AfterBuffer;
+      }
+   }
    if (pf) {
       Int_t res = -1;
       Bool_t free = kTRUE;
@@ -487,10 +500,19 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
          // Note that in the kNotDecompressed case, the above function will return 0;
          // In such a case, we should stop processing
          if (len <= 0) return -len;
+         if (fObjlen > fNbytes - fKeylen && !TestBit(TBufferFile::kNotDecompressed))
+            TTreeCacheUnzip::AddSharedUnzipBuffer(file, pos, recordLen, fBufferRef->Buffer(), len);
          goto AfterBuffer;
       }
    }
 
+   // If the file is memory-mapped, a compressed basket is unzipped straight from the mapping.
+   mappedBuffer = nullptr;
+   if (R__likely(fBranch->GetCompressionLevel() != 0) && file->IsMemoryMapped()) {
+      R__LOCKGUARD_IMT(gROOTMutex); // Lock for parallel TTree I/O
+      mappedBuffer = file->GetMappedBuffer(pos, len);
+   }
+
    // Determine which buffer to use, so that we can avoid a memcpy in case of
    // the basket was not compressed.
    TBuffer* readBufferRef;
@@ -498,6 +520,8 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       // Initialize the buffer to hold the uncompressed data.
       fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, len, file);
       readBufferRef = fBufferRef;
+   } else if (mappedBuffer) {
+      readBufferRef = nullptr;
    } else {
       // Initialize the buffer to hold the compressed data.
       fCompressedBufferRef = R__InitializeReadBasketBuffer(fCompressedBufferRef, len, file);
@@ -508,12 +532,17 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    // and we will re-add the new size later on.
    fBranch->GetTree()->IncrementTotalBuffers(-fBufferSize);
 
-   if (!readBufferRef) {
+   if (!readBufferRef && !mappedBuffer) {
       Error("ReadBasketBuffers", "Unable to allocate buffer.");
       return 1;
    }
 
-   if (pf) {
+   if (mappedBuffer) {
+      // Unstream the header information from the mapping; the record is not copied.
+      TBufferFile mappedBufferRef(TBuffer::kRead, len, const_cast<char *>(mappedBuffer), kFALSE);
+      mappedBufferRef.SetParent(file);
+      Streamer(mappedBufferRef);
+   } else if (pf) {
       TVirtualPerfStats* temp = gPerfStats;
       if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
       Int_t st = 0;
@@ -550,15 +579,16 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       }
       else gPerfStats = temp;
    }
-   Streamer(*readBufferRef);
+   if (!mappedBuffer)
+      Streamer(*readBufferRef);
    if (IsZombie()) {
       return 1;
    }
 
-   rawCompressedBuffer = readBufferRef->Buffer();
+   rawCompressedBuffer = mappedBuffer ? const_cast<char *>(mappedBuffer) : readBufferRef->Buffer();
 
    // Are we done?
-   if (R__unlikely(readBufferRef == fBufferRef)) // We expect most basket to be compressed.
+   if (R__unlikely(!mappedBuffer && readBufferRef == fBufferRef)) // We expect most basket to be compressed.
    {
       if (R__likely(fObjlen+fKeylen == fNbytes)) {
          // The basket was really not compressed as expected.
@@ -618,7 +648,13 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
             goto AfterBuffer;
          }
 
-         R__unzip(&nin, rawCompressedObjectBuffer, &nbuf, (unsigned char*) rawUncompressedObjectBuffer, &nout);
+         if (fBranch->GetCompressionDictionary().empty()) {
+            R__unzip(&nin, rawCompressedObjectBuffer, &nbuf, (unsigned char*) rawUncompressedObjectBuffer, &nout);
+         } else {
+            const auto &dictionary = fBranch->GetCompressionDictionary();
+            R__unzipWithDictionary(&nin, rawCompressedObjectBuffer, &nbuf, (unsigned char*) rawUncompressedObjectBuffer,
+                                   &nout, dictionary.data(), dictionary.size());
+         }
          if (!nout) break;
          noutot += nout;
          nintot += nin;
@@ -634,6 +670,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
          return 1;
       }
       len = fObjlen+fKeylen;
+      TTreeCacheUnzip::AddSharedUnzipBuffer(file, pos, recordLen, rawUncompressedBuffer, len);
       TVirtualPerfStats* temp = gPerfStats;
       if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
       if (R__unlikely(gPerfStats)) {
@@ -1230,6 +1267,10 @@ Int_t TBasket::WriteBuffer()
       char *bufcur = &fBuffer[fKeylen];
       noutot = 0;
       nzip   = 0;
+      // With kZstdDictionary, the branch provides a dictionary trained on its first baskets.
+      const Bool_t useDictionary = (fIOBits & static_cast<UChar_t>(TBasket::EIOBits::kZstdDictionary)) &&
+                                   cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTD;
+      const std::vector<char> *dictionary = nullptr;
       for (Int_t i = 0; i < nbuffers; ++i) {
          if (i == nbuffers - 1) bufmax = fObjlen - nzip;
          else bufmax = kMAXZIPBUF;
@@ -1242,7 +1283,14 @@ Int_t TBasket::WriteBuffer()
          // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
          // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
          // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
+         if (useDictionary && i == 0)
+            dictionary = fBranch->PrepareCompressionDictionary(objbuf, fObjlen);
+         if (dictionary) {
+            R__zipMultipleAlgorithmWithDictionary(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm,
+                                                  dictionary->data(), dictionary->size());
+         } else {
+            R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
+         }
 #ifdef R__USE_IMT
          sentry.lock();
 #endif  // R__USE_IMT
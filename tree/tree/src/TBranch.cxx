@@ -15,6 +15,7 @@
 
 #include "Bytes.h"
 #include "Compression.h"
+#include "RZip.h"
 #include "TBasket.h"
 #include "TBranchBrowsable.h"
 #include "TBrowser.h"
@@ -124,6 +125,7 @@ TBranch::TBranch()
 , fBrowsables(0)
 , fBulk(*this)
 , fSkipZip(kFALSE)
+, fDictionaryTrained(kFALSE)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
 {
@@ -237,6 +239,7 @@ TBranch::TBranch(TTree *tree, const char *name, void *address, const char *leafl
 , fBrowsables(0)
 , fBulk(*this)
 , fSkipZip(kFALSE)
+, fDictionaryTrained(kFALSE)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
 {
@@ -291,6 +294,7 @@ TBranch::TBranch(TBranch *parent, const char *name, void *address, const char *l
 , fBrowsables(0)
 , fBulk(*this)
 , fSkipZip(kFALSE)
+, fDictionaryTrained(kFALSE)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
 {
@@ -2249,6 +2253,50 @@ Int_t TBranch::LoadBaskets()
    return nimported;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the zstd dictionary to use to compress the next basket of this branch,
+/// or nullptr if there is none yet.
+///
+/// Until a dictionary is available, the content of the (small) baskets given
+/// to this function is kept as training sample; once enough samples have been
+/// collected a dictionary is trained and stored in the branch, which passes it
+/// to the decompression of its baskets.  The training is attempted only once
+/// per branch.  Baskets larger than
+/// kMaxDictionarySampleSize do not benefit from a dictionary and are ignored.
+///
+/// This is called by TBasket::WriteBuffer when the IO feature
+/// ROOT::Experimental::EIOFeatures::kZstdDictionary is enabled; the baskets of
+/// a given branch are never compressed concurrently.
+
+const std::vector<char> *TBranch::PrepareCompressionDictionary(const char *basketData, Int_t len)
+{
+   static constexpr Int_t kMaxDictionarySampleSize = 16 * 1024;
+   static constexpr size_t kDictionaryTrainingSize = 64 * 1024;
+   static constexpr Int_t kDictionaryCapacity = 8 * 1024;
+
+   if (!fCompressionDictionary.empty())
+      return &fCompressionDictionary;
+   if (fDictionaryTrained || !basketData || len <= 0 || len > kMaxDictionarySampleSize)
+      return nullptr;
+
+   fDictionarySamples.insert(fDictionarySamples.end(), basketData, basketData + len);
+   fDictionarySampleSizes.push_back(len);
+   if (fDictionarySamples.size() < kDictionaryTrainingSize)
+      return nullptr;
+
+   fDictionaryTrained = kTRUE;
+   std::vector<char> dictionary(kDictionaryCapacity);
+   Int_t dictsize = R__zipTrainDictionary(fDictionarySamples.data(), fDictionarySampleSizes.data(),
+                                          fDictionarySampleSizes.size(), dictionary.data(), kDictionaryCapacity);
+   if (dictsize > 0) {
+      dictionary.resize(dictsize);
+      fCompressionDictionary.swap(dictionary);
+   }
+   std::vector<char>().swap(fDictionarySamples);
+   std::vector<size_t>().swap(fDictionarySampleSizes);
+   return fCompressionDictionary.empty() ? nullptr : &fCompressionDictionary;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print TBranch parameters
 ///
@@ -2888,6 +2936,9 @@ void TBranch::Streamer(TBuffer& b)
       if (v > 9) {
          b.ReadClassBuffer(TBranch::Class(), this, v, R__s, R__c);
 
+         if (!fCompressionDictionary.empty())
+            fDictionaryTrained = kTRUE;
+
          if (fWriteBasket>=fBaskets.GetSize()) {
             fBaskets.Expand(fWriteBasket+1);
          }
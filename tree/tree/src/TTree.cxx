@@ -430,6 +430,7 @@ End_Macro
 
 #include "TBranchIMTHelper.h"
 #include "TNotifyLink.h"
+#include "TTreeClonerReadAhead.h"
 
 #include <chrono>
 #include <cstddef>
@@ -4464,6 +4465,33 @@ Long64_t TTree::Draw(const char* varexp, const TCut& selection, Option_t* option
 /// You can use the option "goff" to turn off the graphics output
 /// of TTree::Draw in the above example.
 ///
+/// ### Multi-threaded TTree::Draw
+///
+/// If implicit multi-threading is enabled (see ROOT::EnableImplicitMT()),
+/// TTree::Draw and TTree::Project process the clusters of the tree in parallel
+/// when the result is a 1-D histogram, a 2-D or 3-D histogram drawn with option
+/// "goff", or a TEntryList:
+/// ~~~ {.cpp}
+///     ROOT::EnableImplicitMT();
+///     TH1D h("h", "px", 100, -5, 5);
+///     tree->Project("h", "px", "pz>4");                   // parallel
+///     tree->Draw("px>>+h", "pz>4");                       // parallel
+///     tree->Draw("px", "pz>4");                           // parallel, see below for htemp
+///     tree->Draw("px>>hnew(100,-5,5)", "pz>4");           // parallel
+///     tree->Draw("py:px>>h2", "pz>4", "goff");            // parallel
+///     tree->Draw(">>elist", "pz>4", "entrylist");         // parallel
+/// ~~~
+/// Every thread evaluates its own copy of the expressions and fills its own copy
+/// of the output; the copies are merged at the end. The axis limits of a new histogram
+/// without a given binning are computed from the first `tree->GetEstimate()` selected
+/// rows, which are processed sequentially before the parallel loop. After the loop
+/// GetSelectedRows(), GetV1(), GetW() etc. return the same values as after a sequential
+/// TTree::Draw. The tree must be read from files that are not open for writing, and the
+/// whole tree must be processed without an input TEventList or TEntryList. Profiles,
+/// graphs, scatter plots, TEventList outputs, the option "same" with a new histogram,
+/// automatic updates of the drawing (see TTree::SetUpdate()) and expressions using
+/// Entry$ or Entries$ are always processed sequentially.
+///
 /// ### Automatic interface to TTree::Draw via the TTreeViewer
 ///
 /// A complete graphical interface to this function is implemented
@@ -6850,6 +6878,60 @@ TTree* TTree::MergeTrees(TList* li, Option_t* options)
    return newtree;
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fast clone the trees of li into target, in order, while the baskets of the
+/// next trees are read concurrently by as many threads as the implicit
+/// multi-threading pool (see ROOT::Internal::TTreeClonerReadAhead).
+/// Chains, trees with an index, trees sharing a file with a previous input or
+/// with the target, and trees that cannot be fast cloned go through
+/// TTree::CopyEntries instead.
+/// Returns kFALSE if li contains an object which is not a TTree.
+
+Bool_t R__MergeWithReadAhead(TTree *target, TCollection *li, Option_t *options)
+{
+   std::vector<TTree *> inputs;
+   std::vector<TTree *> readAhead;
+   std::set<TFile *> files{target->GetCurrentFile()};
+   TIter next(li);
+   TTree *tree;
+   while ((tree = (TTree*)next())) {
+      if (tree == target) continue;
+      if (!tree->InheritsFrom(TTree::Class())) {
+         target->Error("Add","Attempt to add object of class: %s to a %s", tree->ClassName(), target->ClassName());
+         return kFALSE;
+      }
+      inputs.push_back(tree);
+      TFile *file = tree->GetCurrentFile();
+      const Bool_t canReadAhead = file && tree->GetTree() == tree && !tree->GetTreeIndex() &&
+                                  !target->GetTreeIndex() && tree->GetEntries() > 0 && files.insert(file).second;
+      readAhead.push_back(canReadAhead ? tree : nullptr);
+   }
+
+   ROOT::Internal::TTreeClonerReadAhead loader(readAhead, ROOT::GetThreadPoolSize());
+   for (UInt_t i = 0; i < inputs.size(); ++i) {
+      tree = inputs[i];
+      Bool_t cloned = kFALSE;
+      // When the target file is full, TTree::CopyEntries switches to a new one.
+      TFile *targetFile = target->GetCurrentFile();
+      if (readAhead[i] && !(targetFile && targetFile->GetEND() > TTree::GetMaxTreeSize())) {
+         TTreeCloner cloner(tree, target, options, TTreeCloner::kNoWarnings);
+         if (cloner.IsValid()) {
+            target->SetEntries(target->GetEntries() + tree->GetEntries());
+            cloner.SetReadAhead(&loader, i);
+            cloned = cloner.Exec();
+         }
+      }
+      loader.Release(i);
+      if (!cloned)
+         target->CopyEntries(tree, -1, options, kTRUE);
+   }
+   return kTRUE;
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Merge the trees in the TList into this tree.
 ///
@@ -6864,6 +6946,13 @@ Long64_t TTree::Merge(TCollection* li, Option_t *options)
    // Also since this is part of a merging operation, the output file is not as precious as in
    // the general case since the input file should still be around.
    fAutoSave = 0;
+   TString opt = options;
+   opt.ToLower();
+   if (ROOT::IsImplicitMTEnabled() && opt.Contains("fast") && li->GetSize() > 1) {
+      Bool_t status = R__MergeWithReadAhead(this, li, options);
+      fAutoSave = storeAutoSave;
+      return status ? GetEntries() : -1;
+   }
    TIter next(li);
    TTree *tree;
    while ((tree = (TTree*)next())) {
@@ -6927,6 +7016,13 @@ Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
    // Also since this is part of a merging operation, the output file is not as precious as in
    // the general case since the input file should still be around.
    fAutoSave = 0;
+   TString opt = options;
+   opt.ToLower();
+   if (ROOT::IsImplicitMTEnabled() && opt.Contains("fast") && li->GetSize() > 1) {
+      Bool_t status = R__MergeWithReadAhead(this, li, options);
+      fAutoSave = storeAutoSave;
+      return status ? GetEntries() : -1;
+   }
    TIter next(li);
    TTree *tree;
    while ((tree = (TTree*)next())) {
@@ -33,9 +33,16 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
+extern "C" unsigned R__unzip_dictionary_id(Int_t srcsize, UChar_t *src);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
 
 TTreeCacheUnzip::EParUnzipMode TTreeCacheUnzip::fgParallel = TTreeCacheUnzip::kDisable;
@@ -47,6 +54,136 @@ Double_t TTreeCacheUnzip::fgRelBuffSize = .5;
 
 ClassImp(TTreeCacheUnzip);
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Size-bounded LRU cache of unzipped baskets, shared by all the trees of the process.
+///
+/// Baskets are identified by the UUID of their file and by their seek and length in it. The seek alone identifies a
+/// basket within a file, therefore the branch does not need to be part of the key. Entries own a private copy of the
+/// unzipped record (key + object): callers receive their own copy as well, since baskets may deserialize their
+/// buffer in place.
+class RSharedUnzipCache {
+   struct RKey {
+      std::array<UChar_t, 16> fUUID;
+      Long64_t fPos;
+      Int_t fLen;
+
+      bool operator==(const RKey &other) const
+      {
+         return fPos == other.fPos && fLen == other.fLen && fUUID == other.fUUID;
+      }
+   };
+
+   struct RKeyHash {
+      std::size_t operator()(const RKey &key) const
+      {
+         std::size_t h = std::hash<Long64_t>()(key.fPos);
+         for (std::size_t i = 0; i < key.fUUID.size(); i += sizeof(std::size_t)) {
+            std::size_t chunk;
+            memcpy(&chunk, key.fUUID.data() + i, sizeof(chunk));
+            h ^= chunk + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+         }
+         return h;
+      }
+   };
+
+   struct REntry {
+      RKey fKey;
+      std::unique_ptr<char[]> fBuffer;
+      Int_t fSize;
+   };
+
+   std::mutex fLock;
+   std::list<REntry> fEntries; ///< Most recently used first
+   std::unordered_map<RKey, std::list<REntry>::iterator, RKeyHash> fIndex;
+   Long64_t fNBytes = 0;
+
+   void Evict(Long64_t maxBytes)
+   {
+      while (fNBytes > maxBytes && !fEntries.empty()) {
+         fNBytes -= fEntries.back().fSize;
+         fIndex.erase(fEntries.back().fKey);
+         fEntries.pop_back();
+      }
+   }
+
+   static RKey MakeKey(TFile *file, Long64_t pos, Int_t len)
+   {
+      RKey key;
+      file->GetUUID().GetUUID(key.fUUID.data());
+      key.fPos = pos;
+      key.fLen = len;
+      return key;
+   }
+
+public:
+   std::atomic<Long64_t> fMaxBytes{0};
+   std::atomic<Long64_t> fNFound{0};
+   std::atomic<Long64_t> fNMissed{0};
+
+   void SetMaxBytes(Long64_t maxBytes)
+   {
+      std::lock_guard<std::mutex> guard(fLock);
+      fMaxBytes = maxBytes;
+      Evict(maxBytes);
+   }
+
+   bool Get(TFile *file, Long64_t pos, Int_t len, char *&buf, Int_t &size)
+   {
+      const auto key = MakeKey(file, pos, len);
+      std::lock_guard<std::mutex> guard(fLock);
+      auto itr = fIndex.find(key);
+      if (itr == fIndex.end()) {
+         fNMissed++;
+         return false;
+      }
+      fEntries.splice(fEntries.begin(), fEntries, itr->second);
+      size = itr->second->fSize;
+      buf = new char[size];
+      memcpy(buf, itr->second->fBuffer.get(), size);
+      fNFound++;
+      return true;
+   }
+
+   void Add(TFile *file, Long64_t pos, Int_t len, const char *buf, Int_t size)
+   {
+      const Long64_t maxBytes = fMaxBytes;
+      if (size <= 0 || size > maxBytes)
+         return;
+      const auto key = MakeKey(file, pos, len);
+      std::unique_ptr<char[]> copy(new char[size]);
+      memcpy(copy.get(), buf, size);
+
+      std::lock_guard<std::mutex> guard(fLock);
+      auto itr = fIndex.find(key);
+      if (itr != fIndex.end()) {
+         // Another reader was faster: just mark the entry as recently used
+         fEntries.splice(fEntries.begin(), fEntries, itr->second);
+         return;
+      }
+      fEntries.push_front(REntry{key, std::move(copy), size});
+      fIndex.emplace(key, fEntries.begin());
+      fNBytes += size;
+      Evict(maxBytes);
+   }
+};
+
+// Never destructed: trees and files may still be read during the tear down of the process.
+RSharedUnzipCache &GetSharedUnzipCache()
+{
+   static auto *cache = new RSharedUnzipCache;
+   return *cache;
+}
+
+/// Files that are being written might reuse the space of deleted records, so we only share baskets of read-only files.
+bool CanShareBaskets(TFile *file)
+{
+   return file && !file->IsWritable();
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Clear all baskets' state arrays.
 
@@ -442,6 +579,74 @@ Int_t TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::EParUnzipMode option)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function that returns the maximum size in bytes of the process-wide
+/// cache of unzipped baskets. A size of 0 means that the cache is disabled.
+
+Long64_t TTreeCacheUnzip::GetSharedCacheSize()
+{
+   return GetSharedUnzipCache().fMaxBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function that sets the maximum size in bytes of the process-wide
+/// cache of unzipped baskets.
+///
+/// Baskets unzipped by any TTree of the process, e.g. by the tasks of
+/// TTreeProcessorMT or by different TChains and friend trees reading the same
+/// file, are kept in a least-recently-used cache so that readers of the same
+/// baskets do not pay their decompression again. Baskets are identified by the
+/// UUID of their file and by their position in it; only files opened in read
+/// mode take part. The cache is disabled (size 0) by default; setting the size to
+/// 0 releases all the buffers it holds.
+
+void TTreeCacheUnzip::SetSharedCacheSize(Long64_t maxBytes)
+{
+   GetSharedUnzipCache().SetMaxBytes(maxBytes > 0 ? maxBytes : 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function that looks up the unzipped content of the basket record at
+/// position pos and with length len of the given file in the process-wide cache.
+/// In case of success, returns kTRUE and sets buf to a newly allocated copy of
+/// the unzipped record (key + object) of size size; the caller owns buf.
+
+Bool_t TTreeCacheUnzip::GetSharedUnzipBuffer(TFile *file, Long64_t pos, Int_t len, char *&buf, Int_t &size)
+{
+   auto &cache = GetSharedUnzipCache();
+   if (cache.fMaxBytes == 0 || !CanShareBaskets(file))
+      return kFALSE;
+   return cache.Get(file, pos, len, buf, size);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function that adds a copy of the unzipped basket record buf of size
+/// size, read from position pos and length len of file, to the process-wide cache.
+
+void TTreeCacheUnzip::AddSharedUnzipBuffer(TFile *file, Long64_t pos, Int_t len, const char *buf, Int_t size)
+{
+   auto &cache = GetSharedUnzipCache();
+   if (cache.fMaxBytes == 0 || !CanShareBaskets(file))
+      return;
+   cache.Add(file, pos, len, buf, size);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function that returns the number of baskets found in the process-wide cache.
+
+Long64_t TTreeCacheUnzip::GetNSharedFound()
+{
+   return GetSharedUnzipCache().fNFound;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function that returns the number of lookups in the process-wide cache that failed.
+
+Long64_t TTreeCacheUnzip::GetNSharedMissed()
+{
+   return GetSharedUnzipCache().fNMissed;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //                                                                            //
 // From now on we have the methods concerning the unzipping part of the cache //
@@ -549,6 +754,19 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
       return 1;
    }
 
+   // Another reader of the same file might have unzipped this basket already
+   char *sharedbuf = nullptr;
+   Int_t sharedlen = 0;
+   if (GetSharedUnzipBuffer(fFile, rdoffs, rdlen, sharedbuf, sharedlen)) {
+      if ((myCycle != fCycle) || !fIsTransferred) {
+         fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
+         delete [] sharedbuf;
+         return 1;
+      }
+      fUnzipState.SetUnzipped(index, sharedbuf, sharedlen); // Set it as done
+      return 0;
+   }
+
    // Prepare a memory buffer of adequate size
    char* locbuff = 0;
    if (rdlen > 16384) {
@@ -911,6 +1129,13 @@ Int_t TTreeCacheUnzip::UnzipBuffer(char **dest, char *src)
             return uzlen;
          }
 
+         // Only the branch knows the dictionary of its baskets; let TBasket uncompress them.
+         if (R__unzip_dictionary_id(nin, bufcur) != 0) {
+            if(alloc) delete [] *dest;
+            *dest = 0;
+            return -1;
+         }
+
          R__unzip(&nin, bufcur, &nbuf, objbuf, &nout);
 
          if (gDebug > 2)
@@ -952,6 +1177,8 @@ void  TTreeCacheUnzip::Print(Option_t* option) const {
    printf("Number of hits: %d\n", fNFound);
    printf("Number of stalls: %d\n", fNStalls);
    printf("Number of misses: %d\n", fNMissed);
+   if (GetSharedCacheSize() > 0)
+      printf("Number of hits in the process-wide cache: %lld (misses: %lld)\n", GetNSharedFound(), GetNSharedMissed());
 
    TTreeCache::Print(option);
 }
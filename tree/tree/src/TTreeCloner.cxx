@@ -23,6 +23,7 @@ Class implementing or helping  the various TTree cloning method
 #include "TBranchRef.h"
 #include "TError.h"
 #include "TProcessID.h"
+#include "TROOT.h"
 #include "TTree.h"
 #include "TTreeCloner.h"
 #include "TFile.h"
@@ -34,9 +35,15 @@ Class implementing or helping  the various TTree cloning method
 #include "TLeafC.h"
 #include "TFileCacheRead.h"
 #include "TTreeCache.h"
+#include "TTreeClonerReadAhead.h"
 #include "snprintf.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -147,7 +154,9 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
    fToStartEntries(0),
    fCacheSize(0LL),
    fFileCache(nullptr),
-   fPrevCache(nullptr)
+   fPrevCache(nullptr),
+   fReadAhead(nullptr),
+   fReadAheadInput(0)
 {
    TString opt(method);
    opt.ToLower();
@@ -224,6 +233,10 @@ Bool_t TTreeCloner::Exec()
    if (!IsValid()) {
       return kFALSE;
    }
+   if (fReadAhead && !fReadAhead->WaitFor(fReadAheadInput)) {
+      // The input was not loaded ahead, read it here.
+      fReadAhead = nullptr;
+   }
    CreateCache();
    ImportClusterRanges();
    CopyStreamerInfos();
@@ -345,6 +358,22 @@ UInt_t TTreeCloner::CollectBranches(TBranch *from, TBranch *to) {
 
    }
 
+   if (!from->fCompressionDictionary.empty() && from->fCompressionDictionary != to->fCompressionDictionary) {
+      // The copied baskets need the dictionary they were compressed with, and a branch holds only one.
+      if (to->fCompressionDictionary.empty()) {
+         to->fCompressionDictionary = from->fCompressionDictionary;
+         to->fDictionaryTrained = kTRUE;
+      } else {
+         fWarningMsg.Form("The export branch and the import branch (%s) do not use the same compression dictionary.",
+                          from->GetName());
+         if (!(fOptions & kNoWarnings)) {
+            Warning("TTreeCloner::CollectBranches", "%s", fWarningMsg.Data());
+         }
+         fIsValid = kFALSE;
+         return 0;
+      }
+   }
+
    fFromBranches.AddLast(from);
    if (!from->TestBit(TBranch::kDoNotUseBufferMap)) {
       // Make sure that we reset the Buffer's map if needed.
@@ -595,7 +624,7 @@ void TTreeCloner::CopyProcessIds()
 
 void TTreeCloner::CreateCache()
 {
-   if (fCacheSize && fFromTree->GetCurrentFile()) {
+   if (fCacheSize && !fReadAhead && fFromTree->GetCurrentFile()) {
       TFile *f = fFromTree->GetCurrentFile();
       auto prev = fFromTree->GetReadCache(f);
       if (fFileCache && prev == fFileCache) {
@@ -664,6 +693,18 @@ void TTreeCloner::SetCacheSize(Int_t size)
    // beginning of Exec.
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Take the on-file baskets of the input tree from readAhead, which loads them
+/// concurrently with the cloning of the previous inputs of a merge.
+/// \param input Index of the input tree in readAhead.
+/// The baskets that were not loaded ahead are read as usual.
+
+void TTreeCloner::SetReadAhead(ROOT::Internal::TTreeClonerReadAhead *readAhead, UInt_t input)
+{
+   fReadAhead = readAhead;
+   fReadAheadInput = input;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Sort the basket according to the user request.
 
@@ -721,9 +762,29 @@ UInt_t TTreeCloner::FillCache(UInt_t from)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Transfer the basket from the input file to the output file
+///
+/// The baskets loaded ahead by a merge (see SetReadAhead) are taken as they are.
+/// Otherwise, when the implicit multi-threading is enabled (see
+/// ROOT::EnableImplicitMT) and the baskets are copied to a different file, the
+/// baskets are read from the input file by a separate thread, ahead of the one
+/// writing them (see WriteBasketsWithReadAhead).
 
 void TTreeCloner::WriteBaskets()
 {
+   if (!IsInPlace() && !fReadAhead && fMaxBaskets > 1 && ROOT::IsImplicitMTEnabled()) {
+      Bool_t sameFile = kFALSE;
+      for (Int_t i = 0; i <= fFromBranches.GetLast(); ++i) {
+         if (((TBranch *)fFromBranches.UncheckedAt(i))->GetFile(0) == fToFile) {
+            sameFile = kTRUE;
+            break;
+         }
+      }
+      if (!sameFile) {
+         WriteBasketsWithReadAhead();
+         return;
+      }
+   }
+
    TBasket *basket = new TBasket();
    for(UInt_t j = 0, notCached = 0; j<fMaxBaskets; ++j) {
       TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
@@ -752,18 +813,23 @@ void TTreeCloner::WriteBaskets()
             to->fBasketSeek[index] = basket->GetSeekKey();
          }
       } else if (pos!=0) {
-         if (fFileCache && j >= notCached) {
-            notCached = FillCache(notCached);
-         }
-         if (from->GetBasketBytes()[index] == 0) {
-            from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, fromfile);
-         }
-         Int_t len = from->GetBasketBytes()[index];
+         TBasket *loaded = fReadAhead ? fReadAhead->TakeBasket(fReadAheadInput, pos) : nullptr;
+         TBasket *current = loaded ? loaded : basket;
+         if (!loaded) {
+            if (fFileCache && j >= notCached) {
+               notCached = FillCache(notCached);
+            }
+            if (from->GetBasketBytes()[index] == 0) {
+               from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, fromfile);
+            }
+            Int_t len = from->GetBasketBytes()[index];
 
-         basket->LoadBasketBuffers(pos,len,fromfile,fFromTree);
-         basket->IncrementPidOffset(fPidOffset);
-         basket->CopyTo(tofile);
-         to->AddBasket(*basket,kTRUE,fToStartEntries + from->GetBasketEntry()[index]);
+            basket->LoadBasketBuffers(pos,len,fromfile,fFromTree);
+         }
+         current->IncrementPidOffset(fPidOffset);
+         current->CopyTo(tofile);
+         to->AddBasket(*current,kTRUE,fToStartEntries + from->GetBasketEntry()[index]);
+         delete loaded;
       } else {
          TBasket *frombasket = from->GetBasket( index );
          if (frombasket && frombasket->GetNevBuf()>0) {
@@ -776,3 +842,104 @@ void TTreeCloner::WriteBaskets()
    }
    delete basket;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the basket from the input file to the output file, reading the
+/// baskets in a separate thread.
+///
+/// The reading thread loads up to kMaxReadAheadBaskets baskets ahead of the
+/// calling thread, which writes them to the output file in the order given by
+/// fBasketIndex. Only used when none of the input branches are stored in the
+/// output file.
+
+void TTreeCloner::WriteBasketsWithReadAhead()
+{
+   constexpr std::size_t kMaxReadAheadBaskets = 16;
+
+   std::mutex mutex;
+   std::condition_variable cv;
+   std::deque<TBasket *> ready;  // Loaded baskets in the writing order, nullptr for in-memory baskets.
+   std::vector<TBasket *> spare; // Baskets already written, to be reused.
+   Bool_t stop = kFALSE;
+
+   std::thread reader([&]() {
+      for (UInt_t j = 0, notCached = 0; j < fMaxBaskets; ++j) {
+         TBranch *from = (TBranch *)fFromBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+         Int_t index = fBasketNum[fBasketIndex[j]];
+         Long64_t pos = from->GetBasketSeek(index);
+
+         TBasket *basket = nullptr;
+         if (pos != 0) {
+            {
+               std::unique_lock<std::mutex> lock(mutex);
+               cv.wait(lock, [&]() { return stop || ready.size() < kMaxReadAheadBaskets; });
+               if (stop)
+                  return;
+               if (!spare.empty()) {
+                  basket = spare.back();
+                  spare.pop_back();
+               }
+            }
+            if (!basket)
+               basket = new TBasket();
+
+            TFile *fromfile = from->GetFile(0);
+            if (fFileCache && j >= notCached) {
+               notCached = FillCache(notCached);
+            }
+            if (from->GetBasketBytes()[index] == 0) {
+               from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, fromfile);
+            }
+            Int_t len = from->GetBasketBytes()[index];
+            basket->LoadBasketBuffers(pos, len, fromfile, fFromTree);
+         }
+         {
+            std::lock_guard<std::mutex> lock(mutex);
+            ready.push_back(basket);
+         }
+         cv.notify_all();
+      }
+   });
+
+   for (UInt_t j = 0; j < fMaxBaskets; ++j) {
+      TBranch *from = (TBranch *)fFromBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+      TBranch *to = (TBranch *)fToBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+      Int_t index = fBasketNum[fBasketIndex[j]];
+
+      TBasket *basket = nullptr;
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         cv.wait(lock, [&]() { return !ready.empty(); });
+         basket = ready.front();
+         ready.pop_front();
+      }
+      cv.notify_all();
+
+      if (basket) {
+         basket->IncrementPidOffset(fPidOffset);
+         basket->CopyTo(fToFile);
+         to->AddBasket(*basket, kTRUE, fToStartEntries + from->GetBasketEntry()[index]);
+         std::lock_guard<std::mutex> lock(mutex);
+         spare.push_back(basket);
+      } else {
+         TBasket *frombasket = from->GetBasket(index);
+         if (frombasket && frombasket->GetNevBuf() > 0) {
+            TBasket *tobasket = (TBasket *)frombasket->Clone();
+            tobasket->SetBranch(to);
+            to->AddBasket(*tobasket, kFALSE, fToStartEntries + from->GetBasketEntry()[index]);
+            to->FlushOneBasket(to->GetWriteBasket());
+         }
+      }
+   }
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = kTRUE;
+   }
+   cv.notify_all();
+   reader.join();
+
+   for (auto basket : spare)
+      delete basket;
+   for (auto basket : ready)
+      delete basket;
+}
@@ -0,0 +1,194 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2000, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TTreeClonerReadAhead.h"
+
+#include "TBasket.h"
+#include "TBranch.h"
+#include "TBranchRef.h"
+#include "TFile.h"
+#include "TTree.h"
+
+#include <algorithm>
+#include <tuple>
+
+constexpr Long64_t ROOT::Internal::TTreeClonerReadAhead::kMaxBytes;
+
+namespace {
+
+void CollectBranches(TObjArray *branches, std::vector<TBranch *> &result)
+{
+   for (Int_t i = 0; i < branches->GetEntriesFast(); ++i) {
+      TBranch *branch = (TBranch *)branches->UncheckedAt(i);
+      result.push_back(branch);
+      CollectBranches(branch->GetListOfBranches(), result);
+   }
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start loading the baskets of the inputs with nworkers threads.
+/// The null entries of inputs are not loaded, they still need to be released.
+
+ROOT::Internal::TTreeClonerReadAhead::TTreeClonerReadAhead(const std::vector<TTree *> &inputs, UInt_t nworkers)
+   : fInputs(inputs.size()), fWindow(std::max(nworkers, 1u))
+{
+   for (std::size_t i = 0; i < inputs.size(); ++i)
+      fInputs[i].fTree = inputs[i];
+   const std::size_t nthreads = std::min<std::size_t>(fWindow, inputs.size());
+   for (std::size_t i = 0; i < nthreads; ++i)
+      fWorkers.emplace_back(&TTreeClonerReadAhead::Work, this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stop the workers and delete the baskets that were not taken.
+
+ROOT::Internal::TTreeClonerReadAhead::~TTreeClonerReadAhead()
+{
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStop = kTRUE;
+   }
+   fCV.notify_all();
+   for (auto &worker : fWorkers)
+      worker.join();
+   for (auto &input : fInputs) {
+      for (auto &basket : input.fBaskets)
+         delete basket.second;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Load the next inputs until all of them are taken or the reader is destroyed.
+
+void ROOT::Internal::TTreeClonerReadAhead::Work()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   while (true) {
+      fCV.wait(lock, [&]() {
+         return fStop || fNextInput >= fInputs.size() || fNextInput < fFirstUnreleased + fWindow;
+      });
+      if (fStop || fNextInput >= fInputs.size())
+         return;
+
+      const UInt_t index = fNextInput++;
+      RInput &input = fInputs[index];
+      const Long64_t bytes = input.fTree ? input.fTree->GetZipBytes() : 0;
+      if (!input.fTree || bytes > kMaxBytes) {
+         input.fState = EState::kSkipped;
+         fCV.notify_all();
+         continue;
+      }
+      // The oldest input is always loaded, otherwise the inputs after it could hold all the budget.
+      fCV.wait(lock, [&]() { return fStop || index == fFirstUnreleased || fBytesInFlight + bytes <= kMaxBytes; });
+      if (fStop)
+         return;
+      input.fState = EState::kLoading;
+      input.fBytes = bytes;
+      fBytesInFlight += bytes;
+
+      lock.unlock();
+      Load(input);
+      lock.lock();
+
+      input.fState = EState::kLoaded;
+      fCV.notify_all();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Load the on-file baskets of the input, in the order of their position in the file.
+/// The baskets stored in another file than the tree, or which cannot be read, are
+/// left to the TTreeCloner.
+
+void ROOT::Internal::TTreeClonerReadAhead::Load(RInput &input)
+{
+   TTree *tree = input.fTree;
+   TFile *file = tree->GetCurrentFile();
+   std::vector<TBranch *> branches;
+   CollectBranches(tree->GetListOfBranches(), branches);
+   if (tree->GetBranchRef())
+      branches.push_back(tree->GetBranchRef());
+
+   std::vector<std::tuple<Long64_t, TBranch *, Int_t>> toLoad;
+   for (auto branch : branches) {
+      if (branch->GetFile(0) != file)
+         continue;
+      for (Int_t b = 0; b < branch->GetWriteBasket(); ++b) {
+         Long64_t pos = branch->GetBasketSeek(b);
+         if (pos != 0)
+            toLoad.emplace_back(pos, branch, b);
+      }
+   }
+   std::sort(toLoad.begin(), toLoad.end());
+
+   for (auto &item : toLoad) {
+      Long64_t pos = std::get<0>(item);
+      TBranch *branch = std::get<1>(item);
+      Int_t b = std::get<2>(item);
+      TBasket *basket = new TBasket();
+      if (branch->GetBasketBytes()[b] == 0)
+         branch->GetBasketBytes()[b] = basket->ReadBasketBytes(pos, file);
+      if (basket->LoadBasketBuffers(pos, branch->GetBasketBytes()[b], file, tree)) {
+         delete basket;
+         continue;
+      }
+      input.fBaskets.emplace(pos, basket);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait until the input was handled by a worker; returns kTRUE if its baskets
+/// were loaded, kFALSE if the input is to be read by the caller.
+
+Bool_t ROOT::Internal::TTreeClonerReadAhead::WaitFor(UInt_t index)
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   RInput &input = fInputs[index];
+   fCV.wait(lock, [&]() { return input.fState != EState::kPending && input.fState != EState::kLoading; });
+   return input.fState == EState::kLoaded;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the loaded basket at position pos of the input and transfer its
+/// ownership to the caller, or nullptr if it was not loaded.
+/// The input must have been waited for (see WaitFor).
+
+TBasket *ROOT::Internal::TTreeClonerReadAhead::TakeBasket(UInt_t index, Long64_t pos)
+{
+   auto &baskets = fInputs[index].fBaskets;
+   auto iter = baskets.find(pos);
+   if (iter == baskets.end())
+      return nullptr;
+   TBasket *basket = iter->second;
+   baskets.erase(iter);
+   return basket;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete the baskets of the input that were not taken and let the workers
+/// load the next inputs. Must be called for every input, in order.
+
+void ROOT::Internal::TTreeClonerReadAhead::Release(UInt_t index)
+{
+   WaitFor(index);
+   std::lock_guard<std::mutex> lock(fMutex);
+   RInput &input = fInputs[index];
+   for (auto &basket : input.fBaskets)
+      delete basket.second;
+   input.fBaskets.clear();
+   fBytesInFlight -= input.fBytes;
+   input.fBytes = 0;
+   input.fState = EState::kReleased;
+   while (fFirstUnreleased < fInputs.size() && fInputs[fFirstUnreleased].fState == EState::kReleased)
+      ++fFirstUnreleased;
+   fCV.notify_all();
+}
@@ -0,0 +1,85 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2000, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreeClonerReadAhead
+#define ROOT_TTreeClonerReadAhead
+
+#include "RtypesCore.h"
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class TBasket;
+class TTree;
+
+/** \class ROOT::Internal::TTreeClonerReadAhead
+ Loads the on-file baskets of the input trees of a fast merge ahead of their cloning.
+
+ The inputs are loaded concurrently by a set of worker threads, each input by
+ a single thread; the TTreeCloner of each input takes its baskets from here
+ (see TTreeCloner::SetReadAhead) and writes them to the output file. The
+ inputs are thus written one after the other, in their original order, while
+ the next ones are being read.
+
+ At most one input per worker thread, and about kMaxBytes of compressed
+ baskets, are held in memory ahead of the input being cloned. The inputs must
+ be released in order (see Release).
+*/
+
+namespace ROOT {
+namespace Internal {
+
+class TTreeClonerReadAhead {
+public:
+   /// Inputs larger than this are not loaded ahead; also the maximum size of the loaded baskets, unless a
+   /// single input is in flight.
+   static constexpr Long64_t kMaxBytes = 256 * 1024 * 1024;
+
+   TTreeClonerReadAhead(const std::vector<TTree *> &inputs, UInt_t nworkers);
+   ~TTreeClonerReadAhead();
+
+   TTreeClonerReadAhead(const TTreeClonerReadAhead &) = delete;
+   TTreeClonerReadAhead &operator=(const TTreeClonerReadAhead &) = delete;
+
+   Bool_t WaitFor(UInt_t input);
+   TBasket *TakeBasket(UInt_t input, Long64_t pos);
+   void Release(UInt_t input);
+
+private:
+   enum class EState { kPending, kLoading, kLoaded, kSkipped, kReleased };
+
+   struct RInput {
+      TTree *fTree = nullptr;
+      EState fState = EState::kPending;
+      Long64_t fBytes = 0;                   ///< Bytes accounted for this input in fBytesInFlight
+      std::map<Long64_t, TBasket *> fBaskets; ///< Loaded baskets, indexed by their position in the file
+   };
+
+   std::vector<RInput> fInputs;
+   std::vector<std::thread> fWorkers;
+   std::mutex fMutex;
+   std::condition_variable fCV;
+   UInt_t fWindow = 1;          ///< Maximum number of inputs taken by the workers and not yet released
+   UInt_t fNextInput = 0;       ///< Next input to be taken by a worker
+   UInt_t fFirstUnreleased = 0; ///< Oldest input not yet released
+   Long64_t fBytesInFlight = 0; ///< Compressed size of the inputs loaded or being loaded
+   Bool_t fStop = kFALSE;
+
+   void Work();
+   static void Load(RInput &input);
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -6,10 +6,14 @@
 #include "TEnumConstant.h"
 #include "TMemFile.h"
 #include "TTree.h"
+#include "TTreeCacheUnzip.h"
+#include "TFile.h"
+#include "TSystem.h"
 
 #include "ROOT/TestSupport.hxx"
 #include "gtest/gtest.h"
 
+#include <memory>
 #include <vector>
 
 static const Int_t gSampleEvents = 100;
@@ -411,3 +415,102 @@ TEST(TBasket, TestSettingIOBits)
    readEntryOffset = reinterpret_cast<Bool_t *>(reinterpret_cast<char *>(basket2) + offset);
    EXPECT_EQ(*readEntryOffset, kTRUE);
 }
+
+TEST(TBasket, SharedUnzipCache)
+{
+   const auto fileName = "tbasket_sharedunzipcache.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      Int_t idx;
+      t.Branch("idx", &idx, "idx/I")->SetBasketSize(1024);
+      for (idx = 0; idx < 10000; idx++)
+         t.Fill();
+      t.Write();
+   }
+
+   TTreeCacheUnzip::SetSharedCacheSize(10 * 1024 * 1024);
+   const auto nFoundBefore = TTreeCacheUnzip::GetNSharedFound();
+
+   auto readAll = [&]() {
+      std::unique_ptr<TFile> f(TFile::Open(fileName));
+      auto t = f->Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      t->SetCacheSize(0);
+      Int_t idx;
+      t->SetBranchAddress("idx", &idx);
+      for (Long64_t i = 0; i < t->GetEntries(); i++) {
+         t->GetEntry(i);
+         EXPECT_EQ(i, idx);
+      }
+   };
+   // the second reader of the file must find all of its (compressed) baskets unzipped already
+   readAll();
+   const auto nFoundFirst = TTreeCacheUnzip::GetNSharedFound();
+   readAll();
+   const auto nFoundSecond = TTreeCacheUnzip::GetNSharedFound();
+   EXPECT_EQ(nFoundFirst, nFoundBefore);
+   EXPECT_GT(nFoundSecond, nFoundFirst);
+
+   // a disabled cache releases its content and is not queried anymore
+   TTreeCacheUnzip::SetSharedCacheSize(0);
+   readAll();
+   EXPECT_EQ(TTreeCacheUnzip::GetNSharedFound(), nFoundSecond);
+
+   gSystem->Unlink(fileName);
+}
+
+TEST(TBasket, ZstdDictionary)
+{
+   const Int_t nEntries = 50000;
+   // Two files whose branches have the same name but different content, hence different dictionaries
+   auto writeFile = [&](const char *fileName, Int_t factor) {
+      TFile f(fileName, "RECREATE", "", ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose);
+      f.SetCompressionAlgorithm(ROOT::RCompressionSetting::EAlgorithm::kZSTD);
+      TTree t("t", "t");
+      ROOT::TIOFeatures features;
+      features.Set(ROOT::Experimental::EIOFeatures::kZstdDictionary);
+      t.SetIOFeatures(features);
+      Int_t idx;
+      auto br = t.Branch("idx", &idx, "idx/I");
+      br->SetBasketSize(1024);
+      for (Int_t i = 0; i < nEntries; i++) {
+         idx = i * factor;
+         t.Fill();
+      }
+      // the dictionary is trained on the first baskets of the branch
+      EXPECT_FALSE(br->GetCompressionDictionary().empty());
+      t.Write();
+   };
+   writeFile("tbasket_zstddictionary1.root", 1);
+   writeFile("tbasket_zstddictionary2.root", 7);
+
+   // Nothing but the branch read from the file provides the dictionary to the decompression
+   auto readFile = [&](const char *fileName, Int_t factor, bool parallelUnzip) {
+      if (parallelUnzip)
+         TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+      std::unique_ptr<TFile> f(TFile::Open(fileName));
+      auto t = f->Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      auto br = t->GetBranch("idx");
+      ASSERT_NE(br, nullptr);
+      EXPECT_FALSE(br->GetCompressionDictionary().empty());
+      EXPECT_TRUE(br->GetIOFeatures().Test(ROOT::Experimental::EIOFeatures::kZstdDictionary));
+      Int_t idx;
+      t->SetBranchAddress("idx", &idx);
+      EXPECT_EQ(t->GetEntries(), nEntries);
+      for (Long64_t i = 0; i < t->GetEntries(); i++) {
+         ASSERT_GT(t->GetEntry(i), 0);
+         EXPECT_EQ(i * factor, idx);
+      }
+      if (parallelUnzip)
+         TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kDisable);
+   };
+   readFile("tbasket_zstddictionary2.root", 7, false);
+   readFile("tbasket_zstddictionary1.root", 1, false);
+   // the unzip cache leaves the baskets compressed with a dictionary to their branch
+   readFile("tbasket_zstddictionary1.root", 1, true);
+
+   gSystem->Unlink("tbasket_zstddictionary1.root");
+   gSystem->Unlink("tbasket_zstddictionary2.root");
+}
@@ -26,6 +26,8 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 /** \class TTreeView
@@ -73,6 +75,15 @@ public:
 } // End of namespace Internal
 
 class TTreeProcessorMT {
+public:
+   /// Timing information about one task, i.e. one invocation of the function passed to Process.
+   struct RTaskTiming {
+      std::string fFileName; ///< File the entries belong to
+      Long64_t fStart;       ///< First entry of the task (global if a TEntryList or friends are used)
+      Long64_t fEnd;         ///< Entry after the last one of the task
+      double fWallTime;      ///< Wall-clock time spent processing the task, in seconds
+   };
+
 private:
    const std::vector<std::string> fFileNames; ///< Names of the files
    const std::vector<std::string> fTreeNames; ///< TTree names (always same size and ordering as fFileNames)
@@ -85,6 +96,9 @@ private:
    // Must be declared after fPool, for IMT to be initialized first!
    ROOT::TThreadedObject<ROOT::Internal::TTreeView> fTreeView{TNumSlots{ROOT::GetThreadPoolSize()}};
 
+   std::vector<RTaskTiming> fTaskTimings; ///< Timings of the tasks run by the last call to Process
+   std::mutex fTaskTimingsMutex;           ///< Protects fTaskTimings
+
    std::vector<std::string> FindTreeNames();
    static unsigned int fgTasksPerWorkerHint;
 
@@ -96,6 +110,7 @@ public:
    TTreeProcessorMT(TTree &tree, UInt_t nThreads = 0u);
 
    void Process(std::function<void(TTreeReader &)> func);
+   const std::vector<RTaskTiming> &GetTaskTimings() const { return fTaskTimings; }
 
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
@@ -76,6 +76,7 @@ public:
    TSelectorDraw();
    virtual ~TSelectorDraw();
 
+   void              AddSelectedRows(Long64_t nrows, Int_t nfill);
    virtual void      Begin(TTree *tree);
    virtual Int_t     GetAction() const {return fAction;}
    virtual Bool_t    GetCleanElist() const {return fCleanElist;}
@@ -99,6 +99,23 @@ TSelectorDraw::~TSelectorDraw()
    if (fW)     delete [] fW;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Account for nrows rows selected outside of the entry loop of this selector,
+/// e.g. by the tasks of the multi-threaded TTree::Draw, after Terminate() was called.
+/// The caller has already filled the output object and copied the last rows into
+/// the arrays returned by GetVal() and GetW(); nfill is the number of valid values
+/// in these arrays, see GetVal(). The axis limits of the output are final.
+
+void TSelectorDraw::AddSelectedRows(Long64_t nrows, Int_t nfill)
+{
+   if (fAction < 0) fAction = -fAction;
+   fSelectedRows += nrows;
+   fNfill = nfill;
+   // Terminate() disables the drawing of an empty selection
+   if (fSelectedRows > 0 && fDraw == 1 && !TestBit(kCustomHistogram)) fDraw = 0;
+   SetStatus(fSelectedRows);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Called every time a loop on the tree(s) starts.
 
@@ -85,6 +85,23 @@ extra libraries (Histogram, display, etc).
 #include "Fit/UnBinData.h"
 #include "Math/MinimizerOptions.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TTreeProcessorMT.hxx"
+#include "TError.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "TProfile3D.h"
+#include "TTreeReader.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#endif
+
 
 R__EXTERN Foption_t Foption;
 
@@ -329,6 +346,520 @@ Long64_t TTreePlayer::DrawScript(const char* wrapperPrefix,
    return result;
 }
 
+#ifdef R__USE_IMT
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// The compiled variables and selection of a TTree::Draw() for one tree, as used by
+/// TTreePlayer::DrawSelectMT(). Every task of the multi-threaded TTree::Draw has its own instance.
+/// The bookkeeping follows TSelectorDraw::CompileVariables(), TSelectorDraw::ProcessFill() and
+/// TSelectorDraw::ProcessFillMultiple() such that the same values are filled.
+
+class TDrawFormulas {
+   std::unique_ptr<TTreeFormula> fSelect;             ///< Selection, null if there is none
+   std::vector<std::unique_ptr<TTreeFormula>> fVars;  ///< The ':' separated variables
+   TTreeFormulaManager *fManager = nullptr;           ///< Owned by the formulas
+   Int_t fMultiplicity = 0;
+   Bool_t fForceRead = kFALSE;
+   Bool_t fSelectMultiple = kFALSE;
+   std::vector<Bool_t> fVarMultiple;
+
+public:
+   TDrawFormulas() = default;
+   TDrawFormulas(const TDrawFormulas &) = delete;
+   TDrawFormulas &operator=(const TDrawFormulas &) = delete;
+   ~TDrawFormulas()
+   {
+      // The manager is deleted together with the last of its formulas
+      fVars.clear();
+      fSelect.reset();
+   }
+
+   /// Returns kFALSE if one of the expressions does not compile or does not evaluate to a number.
+   Bool_t Compile(TTree *tree, const std::vector<TString> &varnames, const char *selection)
+   {
+      if (selection && strlen(selection)) {
+         fSelect.reset(new TTreeFormula("Selection", selection, tree));
+         fSelect->SetQuickLoad(kTRUE);
+         if (!fSelect->GetNdim())
+            return kFALSE;
+      }
+
+      tree->ResetBit(TTree::kForceRead);
+      if (varnames.empty()) {
+         if (fSelect)
+            fManager = fSelect->GetManager();
+      } else {
+         fManager = new TTreeFormulaManager();
+         if (fSelect)
+            fManager->Add(fSelect.get());
+         for (std::size_t i = 0; i < varnames.size(); ++i) {
+            fVars.emplace_back(new TTreeFormula(TString::Format("Var%zu", i + 1), varnames[i].Data(), tree));
+            fVars.back()->SetQuickLoad(kTRUE);
+            fManager->Add(fVars.back().get());
+            if (!fVars.back()->GetNdim() || fVars.back()->IsString() || fVars.back()->EvalClass())
+               return kFALSE;
+         }
+      }
+      if (fManager) {
+         fManager->Sync();
+         if (fManager->GetMultiplicity() == -1)
+            tree->SetBit(TTree::kForceRead);
+         if (fManager->GetMultiplicity() >= 1)
+            fMultiplicity = fManager->GetMultiplicity();
+      }
+
+      fForceRead = tree->TestBit(TTree::kForceRead);
+      fSelectMultiple = fSelect && fSelect->GetMultiplicity();
+      for (auto &var : fVars)
+         fVarMultiple.push_back(var->GetMultiplicity() != 0);
+      return kTRUE;
+   }
+
+   /// To be called when the chain switches to a new tree, see TSelectorDraw::Notify().
+   void UpdateFormulaLeaves()
+   {
+      for (auto &var : fVars)
+         var->UpdateFormulaLeaves();
+      if (fSelect)
+         fSelect->UpdateFormulaLeaves();
+   }
+
+   /// Evaluates the current entry and calls fill(values, weight) for every selected instance.
+   /// Returns the number of calls to fill.
+   template <typename FillFunc>
+   Long64_t ProcessEntry(Double_t weight, FillFunc fill)
+   {
+      const std::size_t dim = fVars.size();
+      Double_t vals[3] = {0, 0, 0};
+
+      // simple case with no multiplicity
+      if (!fMultiplicity) {
+         if (fForceRead && fManager->GetNdata() <= 0)
+            return 0;
+         Double_t w = weight;
+         if (fSelect) {
+            w *= fSelect->EvalInstance(0);
+            if (!w)
+               return 0;
+         }
+         for (std::size_t k = 0; k < dim; ++k)
+            vals[k] = fVars[k]->EvalInstance(0);
+         fill(vals, w);
+         return 1;
+      }
+
+      Int_t ndata = fManager->GetNdata();
+      if (!ndata)
+         return 0;
+
+      Long64_t nfill = 0;
+      Double_t vals0[3] = {0, 0, 0};
+      Double_t w = fSelect ? weight * fSelect->EvalInstance(0) : weight;
+      if (!w && !fSelectMultiple)
+         return 0;
+      // Always call EvalInstance(0) to insure the loading of the branches
+      if (w) {
+         for (std::size_t k = 0; k < dim; ++k)
+            vals0[k] = fVars[k]->EvalInstance(0);
+         fill(vals0, w);
+         ++nfill;
+      } else {
+         for (auto &var : fVars)
+            var->ResetLoading();
+      }
+
+      for (Int_t i = 1; i < ndata; ++i) {
+         if (fSelectMultiple) {
+            w = weight * fSelect->EvalInstance(i);
+            if (w == 0)
+               continue;
+            if (nfill == 0) {
+               for (std::size_t k = 0; k < dim; ++k) {
+                  if (!fVarMultiple[k])
+                     vals0[k] = fVars[k]->EvalInstance(0);
+               }
+            }
+         }
+         for (std::size_t k = 0; k < dim; ++k)
+            vals[k] = fVarMultiple[k] ? fVars[k]->EvalInstance(i) : vals0[k];
+         fill(vals, w);
+         ++nfill;
+      }
+      return nfill;
+   }
+};
+
+} // anonymous namespace
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Multi-threaded version of the entry loop of DrawSelect() for the requests that fill
+/// a 1-D histogram, a 2-D or 3-D histogram with option "goff", or an entry list, such as
+/// `tree->Draw("x")`, `tree->Draw("x>>h(100,0,1)")`, `tree->Draw("y:x>>h", "z>0", "goff")`,
+/// `tree->Project("h", "x")` or `tree->Draw(">>elist", "x>0", "entrylist")`.
+///
+/// The output object is created, resp. reset, by fSelector exactly as in the single-threaded
+/// case. If the axis limits of a new histogram are not given, fSelector first processes
+/// sequentially the entries that give the first `tree->GetEstimate()` selected rows, from
+/// which it computes the limits, see TSelectorDraw::TakeEstimate(). The remaining entries
+/// are split by cluster and processed by a TTreeProcessorMT: every task compiles its own
+/// TTreeFormula instances and fills a per-thread copy of the histogram resp. its own entry
+/// list, the copies are merged into the output at the end. The selected rows of the tasks
+/// are collected in entry order such that the arrays of fSelector, see TSelectorDraw::GetVal(),
+/// hold the same values as after a single-threaded loop.
+///
+/// Returns kFALSE without side effects if the request is not supported, in which case
+/// DrawSelect() processes it on a single thread. Otherwise nrows is set to the number of
+/// selected rows, or to -1 in case of error. Unsupported are, among others, profiles,
+/// graphs, TEventList outputs, input entry lists, entry ranges, trees with unsaved entries,
+/// automatic updates of the drawing (see TTree::SetUpdate()) and expressions using Entry$
+/// or Entries$.
+
+Bool_t TTreePlayer::DrawSelectMT(const char *varexp0, const char *selection, Option_t *option,
+                                 Long64_t nentries, Long64_t firstentry, Long64_t &nrows)
+{
+#ifndef R__USE_IMT
+   (void)varexp0;
+   (void)selection;
+   (void)option;
+   (void)nentries;
+   (void)firstentry;
+   (void)nrows;
+   return kFALSE;
+#else
+   if (!ROOT::IsImplicitMTEnabled())
+      return kFALSE;
+   if (fTree->GetEventList() || fTree->GetEntryList())
+      return kFALSE;
+   // The drawing is updated during the entry loop
+   if (fTree->GetUpdate())
+      return kFALSE;
+   const Long64_t nTotal = fTree->GetEntries();
+   if (firstentry > 0 || nentries < nTotal)
+      return kFALSE;
+   if (!fTree->InheritsFrom(TChain::Class())) {
+      // The tasks read the tree from its file, they would miss entries that are not yet written
+      TFile *file = fTree->GetCurrentFile();
+      if (!file || file->IsWritable())
+         return kFALSE;
+   }
+
+   TString opt = option;
+   opt.ToLower();
+   for (auto unsupported : {"para", "candle", "gl5d", "prof", "entrylistarray"}) {
+      if (opt.Contains(unsupported))
+         return kFALSE;
+   }
+
+   // Split "varexp>>+hname(binning)", without ">>" the histogram is htemp
+   TString varexp = varexp0;
+   TString hname;
+   Bool_t hnameplus = kFALSE;
+   Ssiz_t pos = kNPOS;
+   for (Ssiz_t k = varexp.Length() - 1; k > 0; --k) {
+      if (varexp[k] == '>' && varexp[k - 1] == '>') {
+         pos = k - 1;
+         break;
+      }
+   }
+   if (pos != kNPOS) {
+      hname = varexp(pos + 2, varexp.Length() - pos - 2);
+      varexp.Remove(pos);
+      hname = hname.Strip(TString::kBoth);
+      hnameplus = hname.BeginsWith("+");
+      if (hnameplus)
+         hname = TString(hname(1, hname.Length() - 1)).Strip(TString::kLeading);
+   }
+   TString binning;
+   const Ssiz_t open = hname.First('(');
+   if (open != kNPOS) {
+      if (hname.CountChar('(') != 1 || hname.CountChar(')') != 1 || !hname.EndsWith(")"))
+         return kFALSE;
+      binning = hname(open + 1, hname.Length() - open - 2);
+      hname = TString(hname(0, open)).Strip(TString::kTrailing);
+   }
+   if (pos != kNPOS && hname.IsNull())
+      return kFALSE;
+
+   TString sel = selection;
+   // The tasks do not know the entry numbers of the whole tree
+   if (varexp.Contains("Entry$") || varexp.Contains("Entries$") || sel.Contains("Entry$") || sel.Contains("Entries$"))
+      return kFALSE;
+
+   std::vector<TString> varnames;
+   if (!varexp.Strip(TString::kBoth).IsNull())
+      fSelector->SplitNames(varexp, varnames);
+   const Int_t dim = varnames.size();
+   if (dim > 3)
+      return kFALSE;
+
+   // Whether the axis limits of a new histogram are computed from the first selected rows
+   Bool_t needsEstimate = kFALSE;
+   if (dim == 0) {
+      if (!opt.Contains("entrylist") || hname.IsNull() || !binning.IsNull())
+         return kFALSE;
+      TObject *oldObject = gDirectory->Get(hname);
+      if (oldObject && oldObject->IsA() != TEntryList::Class())
+         return kFALSE;
+   } else {
+      // Without "goff", TSelectorDraw draws 2D and 3D expressions as scatter plots
+      if (dim > 1 && !opt.Contains("goff"))
+         return kFALSE;
+      // With a binning or without a name, TSelectorDraw creates a new histogram
+      TObject *oldObject = (hname.IsNull() || !binning.IsNull()) ? nullptr : gDirectory->Get(hname);
+      if (oldObject) {
+         auto hist = dynamic_cast<TH1 *>(oldObject);
+         if (!hist || hist->GetDimension() != dim || hist->GetBuffer())
+            return kFALSE;
+         if (hist->InheritsFrom(TProfile::Class()) || hist->InheritsFrom(TProfile2D::Class()) ||
+             hist->InheritsFrom(TProfile3D::Class())) {
+            return kFALSE;
+         }
+      } else {
+         // The option "same" takes the axis limits from the pad
+         if (hnameplus || opt.Contains("same"))
+            return kFALSE;
+         // "hname(nbinsx,xmin,xmax,nbinsy,ymin,ymax,...)", with the variables in reverse order
+         std::unique_ptr<TObjArray> args(binning.Tokenize(","));
+         for (Int_t k = 0; k < dim && !needsEstimate; ++k) {
+            if (args->GetEntriesFast() < 3 * k + 3) {
+               needsEstimate = kTRUE;
+            } else {
+               const TString low = static_cast<TObjString *>(args->At(3 * k + 1))->GetString().Strip(TString::kBoth);
+               const TString up = static_cast<TObjString *>(args->At(3 * k + 2))->GetString().Strip(TString::kBoth);
+               needsEstimate = !low.IsFloat() || !up.IsFloat() || low.Atof() >= up.Atof();
+            }
+         }
+      }
+   }
+
+   std::unordered_map<std::string, Long64_t> fileOffsets;
+   if (auto chain = dynamic_cast<TChain *>(fTree)) {
+      // The tasks see one file at a time, the entry numbers of the chain are recovered from the file names
+      Int_t treeNumber = 0;
+      for (auto element : *chain->GetListOfFiles()) {
+         if (!fileOffsets.emplace(element->GetTitle(), chain->GetTreeOffset()[treeNumber++]).second)
+            return kFALSE;
+      }
+   }
+
+   // A chain needs a current tree to compile the expressions
+   if (!fTree->GetTree() && fTree->LoadTree(0) < 0)
+      return kFALSE;
+
+   // A chain without a global weight uses the weight of its current tree, see TChain::GetWeight()
+   const Bool_t useTreeWeight = fTree->InheritsFrom(TChain::Class()) && !fTree->TestBit(TChain::kGlobalWeight);
+   const Double_t globalWeight = fTree->GetWeight();
+
+   // Number of leading entries processed by fSelector on this thread
+   Long64_t nFirst = 0;
+   {
+      // Unsupported expressions are left to the single-threaded code path, which reports the errors
+      Int_t oldErrorIgnoreLevel = gErrorIgnoreLevel;
+      gErrorIgnoreLevel = kFatal;
+      TDrawFormulas formulas;
+      Bool_t isSupported = formulas.Compile(fTree, varnames, sel);
+      gErrorIgnoreLevel = oldErrorIgnoreLevel;
+      if (!isSupported)
+         return kFALSE;
+
+      // Count the entries that give the rows from which TSelectorDraw::TakeEstimate() computes the axis limits
+      if (needsEstimate) {
+         const Long64_t estimate = fTree->GetEstimate();
+         Long64_t nrowsFirst = 0;
+         Int_t treeNumber = -1;
+         Double_t weight = globalWeight;
+         while (nFirst < nTotal && nrowsFirst < estimate) {
+            if (fTree->LoadTree(nFirst) < 0)
+               break;
+            if (fTree->GetTreeNumber() != treeNumber) {
+               treeNumber = fTree->GetTreeNumber();
+               if (useTreeWeight)
+                  weight = fTree->GetTree()->GetWeight();
+               formulas.UpdateFormulaLeaves();
+            }
+            nrowsFirst += formulas.ProcessEntry(weight, [](const Double_t *, Double_t) {});
+            ++nFirst;
+         }
+      }
+   }
+
+   // Creates resp. resets the output object and, if needed, fixes the axis limits
+   nrows = Process(fSelector, option, nFirst, 0);
+   if (nrows < 0 || nFirst == nTotal)
+      return kTRUE;
+
+   const Int_t action = fSelector->GetAction();
+   TObject *object = fSelector->GetObject();
+   TH1 *hist = nullptr;
+   TEntryList *elist = nullptr;
+   Bool_t isSupported = kFALSE;
+   if (dim == 0) {
+      elist = dynamic_cast<TEntryList *>(object);
+      isSupported = action == 5 && elist && elist->IsA() == TEntryList::Class();
+   } else {
+      hist = dynamic_cast<TH1 *>(object);
+      // A negative action means that the axis limits of the new histogram are yet to be computed,
+      // TSelectorDraw does not fill 3-D histograms of its own, it draws them as scatter plots
+      isSupported = TMath::Abs(action) == dim && hist && hist->GetDimension() == dim && !hist->GetBuffer() &&
+                    !(action < 0 && hist->CanExtendAllAxes()) && !(dim == 3 && hist->TestBit(kCanDelete));
+   }
+   if (!isSupported) {
+      nrows = Process(fSelector, option, nentries, firstentry);
+      return kTRUE;
+   }
+
+   const Long64_t estimate = fTree->GetEstimate();
+   // Values of the variables followed by the weight, for each selected row
+   const std::size_t stride = dim + 1;
+   struct TRowBuffer {
+      Long64_t fNRows = 0;
+      std::vector<Double_t> fValues; ///< The last `estimate` rows, row i at (i % estimate) * stride
+   };
+   TList *aliases = fTree->GetListOfAliases();
+
+   std::mutex mutex;
+   Long64_t nrowsMT = 0;
+   Bool_t hasFailed = kFALSE;
+   // One copy of the histogram per concurrently running task
+   std::vector<std::unique_ptr<TH1>> histCopies;
+   std::vector<TH1 *> freeHistCopies;
+   // The rows of the tasks, by their first entry
+   std::map<Long64_t, TRowBuffer> rowBuffers;
+
+   ROOT::TTreeProcessorMT processor(*fTree);
+   processor.Process([&](TTreeReader &reader) {
+      TTree *tree = reader.GetTree();
+      if (aliases) {
+         TIter next(aliases);
+         while (auto alias = static_cast<TNamed *>(next()))
+            tree->SetAlias(alias->GetName(), alias->GetTitle());
+      }
+
+      TH1 *localHist = nullptr;
+      if (hist) {
+         std::lock_guard<std::mutex> lock(mutex);
+         if (freeHistCopies.empty()) {
+            TDirectory::TContext ctx(nullptr);
+            histCopies.emplace_back(static_cast<TH1 *>(hist->Clone()));
+            histCopies.back()->SetDirectory(nullptr);
+            histCopies.back()->Reset();
+            freeHistCopies.push_back(histCopies.back().get());
+         }
+         localHist = freeHistCopies.back();
+         freeHistCopies.pop_back();
+      }
+      TEntryList localList;
+      TRowBuffer rows;
+
+      TDrawFormulas formulas;
+      Bool_t isCompiled = kFALSE;
+      Int_t treeNumber = -1;
+      Long64_t fileOffset = 0;
+      Long64_t firstEntry = -1;
+      Double_t weight = globalWeight;
+      Long64_t nfill = 0;
+      Bool_t isFailed = kFALSE;
+      while (reader.Next()) {
+         if (tree->GetTreeNumber() != treeNumber) {
+            treeNumber = tree->GetTreeNumber();
+            if (!fileOffsets.empty()) {
+               auto fileName = static_cast<TChain *>(tree)->GetListOfFiles()->At(treeNumber)->GetTitle();
+               auto offset = fileOffsets.find(fileName);
+               if (offset == fileOffsets.end()) {
+                  isFailed = kTRUE;
+                  break;
+               }
+               fileOffset = offset->second;
+            }
+            if (useTreeWeight)
+               weight = tree->GetTree()->GetWeight();
+            if (isCompiled) {
+               formulas.UpdateFormulaLeaves();
+            } else if (formulas.Compile(tree, varnames, sel)) {
+               isCompiled = kTRUE;
+            } else {
+               isFailed = kTRUE;
+               break;
+            }
+         }
+         // The leading entries were processed by fSelector
+         const Long64_t entry = fileOffset + tree->GetTree()->GetReadEntry();
+         if (entry < nFirst)
+            continue;
+         if (firstEntry < 0)
+            firstEntry = entry;
+
+         const Long64_t currentEntry = reader.GetCurrentEntry();
+         nfill += formulas.ProcessEntry(weight, [&](const Double_t *v, Double_t w) {
+            switch (dim) {
+            case 0: localList.Enter(currentEntry, tree); return;
+            case 1: localHist->Fill(v[0], w); break;
+            case 2: static_cast<TH2 *>(localHist)->Fill(v[1], v[0], w); break;
+            default: static_cast<TH3 *>(localHist)->Fill(v[2], v[1], v[0], w);
+            }
+            const std::size_t offset = (rows.fNRows++ % estimate) * stride;
+            if (offset == rows.fValues.size())
+               rows.fValues.resize(offset + stride);
+            std::copy(v, v + dim, rows.fValues.begin() + offset);
+            rows.fValues[offset + dim] = w;
+         });
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+      nrowsMT += nfill;
+      hasFailed = hasFailed || isFailed;
+      if (localHist)
+         freeHistCopies.push_back(localHist);
+      if (localList.GetN() > 0)
+         elist->Add(&localList);
+      if (rows.fNRows > 0) {
+         rowBuffers[firstEntry] = std::move(rows);
+         // Only the last `estimate` rows can end up in the arrays of fSelector
+         Long64_t nrowsAfter = 0;
+         for (auto it = rowBuffers.rbegin(); it != rowBuffers.rend(); ++it) {
+            if (nrowsAfter >= estimate) {
+               it->second.fValues.clear();
+               it->second.fValues.shrink_to_fit();
+            }
+            nrowsAfter += it->second.fNRows;
+         }
+      }
+   });
+
+   if (hist && !histCopies.empty()) {
+      // Unlike TH1::Add(), TH1::Merge() copes with copies whose axes were extended differently
+      TList copies;
+      for (auto &h : histCopies)
+         copies.Add(h.get());
+      hist->Merge(&copies);
+   }
+   if (hasFailed)
+      Error("DrawSelect", "could not process all the trees, the result is incomplete");
+
+   // As in the single-threaded loop, the arrays hold the rows since the last multiple of `estimate`
+   const Long64_t nrowsFirst = fSelector->GetSelectedRows();
+   const Long64_t nrowsTotal = nrowsFirst + nrowsMT;
+   const Long64_t firstKept = nrowsTotal > 0 ? ((nrowsTotal - 1) / estimate) * estimate : 0;
+   Long64_t row = nrowsFirst;
+   for (auto &item : rowBuffers) {
+      const TRowBuffer &rows = item.second;
+      for (Long64_t i = std::max<Long64_t>(firstKept - row, 0); i < rows.fNRows; ++i) {
+         const Double_t *v = &rows.fValues[(i % estimate) * stride];
+         const Long64_t k = (row + i) % estimate;
+         for (Int_t j = 0; j < dim; ++j)
+            fSelector->GetVal(j)[k] = v[j];
+         fSelector->GetW()[k] = v[dim];
+      }
+      row += rows.fNRows;
+   }
+   fSelector->AddSelectedRows(nrowsMT, static_cast<Int_t>(nrowsTotal % estimate));
+   nrows = fSelector->GetSelectedRows();
+   return kTRUE;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Draw expression varexp for specified entries that matches the selection.
 /// Returns -1 in case of error or number of selected events in case of success.
@@ -415,8 +946,10 @@ Long64_t TTreePlayer::DrawSelect(const char *varexp0, const char *selection, Opt
    // Do not process more than fMaxEntryLoop entries
    if (nentries > fTree->GetMaxEntryLoop()) nentries = fTree->GetMaxEntryLoop();
 
-   // invoke the selector
-   Long64_t nrows = Process(fSelector,option,nentries,firstentry);
+   // invoke the selector, on several threads with implicit multi-threading
+   Long64_t nrows;
+   if (optgl5d || !DrawSelectMT(varexp0, selection, option, nentries, firstentry, nrows))
+      nrows = Process(fSelector,option,nentries,firstentry);
    fSelectedRows = nrows;
    fDimension = fSelector->GetDimension();
 
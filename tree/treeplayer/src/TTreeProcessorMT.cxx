@@ -19,14 +19,27 @@ passes a function whose only parameter is a TTreeReader. The function iterates
 on a subrange of entries by using that TTreeReader.
 
 The implementation of ROOT::TTreeProcessorMT parallelizes the processing of the subranges,
-each corresponding to a cluster in the TTree. This is possible thanks to the use
+each made of one or more clusters in the TTree. This is possible thanks to the use
 of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTree
 objects.
+
+The size of the subranges adapts to the number of workers (see SetTasksPerWorkerHint()):
+small clusters are merged together, while the clusters of files that have too few of them
+to keep all workers busy are split, so that the end of the processing is not bound to a few
+large clusters. Clusters are only split at entries where all branches start a new basket,
+so that no basket is read by more than one task. Subranges are picked up dynamically by
+idle workers. The wall-clock time spent in each task is available via GetTaskTimings().
 */
 
+#include "TBranch.h"
+#include "TLeaf.h"
 #include "TROOT.h"
 #include "ROOT/TTreeProcessorMT.hxx"
 
+#include <algorithm>
+#include <chrono>
+#include <iterator> // std::back_inserter
+
 using namespace ROOT;
 
 namespace {
@@ -123,6 +136,74 @@ ConvertToElistClusters(std::vector<std::vector<EntryCluster>> &&clusters, TEntry
    return elistClusters;
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Return the sorted entries, between 0 and the number of entries of the tree excluded, at which all branches of the
+/// tree start a new basket.
+static std::vector<Long64_t> GetCommonBasketBoundaries(TTree &t)
+{
+   std::vector<Long64_t> boundaries;
+   bool isFirstBranch = true;
+   for (auto *leafObj : *t.GetListOfLeaves()) {
+      auto *branch = static_cast<TLeaf *>(leafObj)->GetBranch();
+      const Long64_t *basketEntry = branch->GetBasketEntry();
+      const auto nBaskets = branch->GetWriteBasket();
+      if (!basketEntry || nBaskets <= 0)
+         continue;
+      std::vector<Long64_t> thisBranchBoundaries(basketEntry + 1, basketEntry + nBaskets);
+      if (isFirstBranch) {
+         boundaries = std::move(thisBranchBoundaries);
+         isFirstBranch = false;
+      } else {
+         std::vector<Long64_t> common;
+         std::set_intersection(boundaries.begin(), boundaries.end(), thisBranchBoundaries.begin(),
+                               thisBranchBoundaries.end(), std::back_inserter(common));
+         boundaries = std::move(common);
+      }
+      if (boundaries.empty())
+         break;
+   }
+   return boundaries;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Split the clusters of a file so that they can be distributed over up to maxTasksPerFile tasks.
+///
+/// Clusters larger than the average task size are split at the entries in basketBoundaries, i.e. where all branches
+/// start a new basket, so that no basket has to be read and decompressed by more than one task. The split points are
+/// chosen as close as possible to equally sized sub-ranges. The resulting ranges are still sorted and contiguous.
+static std::vector<EntryCluster> SplitClusters(const std::vector<EntryCluster> &clusters,
+                                               const std::vector<Long64_t> &basketBoundaries,
+                                               unsigned int maxTasksPerFile)
+{
+   if (clusters.empty() || basketBoundaries.empty())
+      return clusters;
+
+   const Long64_t nEntries = clusters.back().end - clusters.front().start;
+   const Long64_t maxRangeSize = std::max(1ll, (nEntries + maxTasksPerFile - 1) / maxTasksPerFile);
+   std::vector<EntryCluster> ranges;
+   for (const auto &c : clusters) {
+      auto boundaryIt = std::upper_bound(basketBoundaries.begin(), basketBoundaries.end(), c.start);
+      const auto boundaryEnd = std::lower_bound(boundaryIt, basketBoundaries.end(), c.end);
+      Long64_t start = c.start;
+      // the last boundary we could split at, if any
+      Long64_t lastBoundary = -1;
+      for (; boundaryIt != boundaryEnd; ++boundaryIt) {
+         const auto boundary = *boundaryIt;
+         if (boundary - start >= maxRangeSize) {
+            // split at whichever of the two boundaries around the ideal split point is closest to it
+            const auto idealEnd = start + maxRangeSize;
+            const auto end =
+               (lastBoundary > start && idealEnd - lastBoundary < boundary - idealEnd) ? lastBoundary : boundary;
+            ranges.emplace_back(EntryCluster{start, end});
+            start = end;
+         }
+         lastBoundary = boundary;
+      }
+      ranges.emplace_back(EntryCluster{start, c.end});
+   }
+   return ranges;
+}
+
 // EntryClusters and number of entries per file
 using ClustersAndEntries = std::pair<std::vector<std::vector<EntryCluster>>, std::vector<Long64_t>>;
 
@@ -169,6 +250,14 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
          // Add the current file's offset to start and end to make them (chain) global
          clusters.emplace_back(EntryCluster{start + offset, end + offset});
       }
+      // Files with fewer clusters than tasks to run have their clusters split, so that the tail of the processing
+      // does not hang on a few large clusters. We only split where no basket is shared between the sub-ranges.
+      if (clusters.size() < maxTasksPerFile) {
+         auto boundaries = GetCommonBasketBoundaries(*t);
+         for (auto &b : boundaries)
+            b += offset;
+         clusters = SplitClusters(clusters, boundaries, maxTasksPerFile);
+      }
       offset += entries;
       clustersPerFile.emplace_back(std::move(clusters));
       entriesPerFile.emplace_back(entries);
@@ -550,14 +639,20 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
          shouldRetrieveAllClusters ? entries : std::vector<Long64_t>({theseClustersAndEntries.second[0]});
 
       auto processCluster = [&](const EntryCluster &c) {
+         const auto startTime = std::chrono::steady_clock::now();
          auto r = fTreeView->GetTreeReader(c.start, c.end, theseTrees, theseFiles, fFriendInfo, fEntryList,
                                            theseEntries, friendEntries);
          func(*r);
+         const std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - startTime;
+         std::lock_guard<std::mutex> lock(fTaskTimingsMutex);
+         fTaskTimings.emplace_back(RTaskTiming{fFileNames[fileIdx], c.start, c.end, wallTime.count()});
       };
 
       fPool.Foreach(processCluster, thisFileClusters);
    };
 
+   fTaskTimings.clear();
+
    std::vector<std::size_t> fileIdxs(fFileNames.size());
    std::iota(fileIdxs.begin(), fileIdxs.end(), 0u);
 
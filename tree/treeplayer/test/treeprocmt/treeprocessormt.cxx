@@ -1,12 +1,18 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <iterator>
 #include <random>
 #include <string>
 #include <thread>
 #include <utility>
 
+#include <TBranch.h>
+#include <TEntryList.h>
 #include <TFile.h>
+#include <TH1.h>
+#include <TH1D.h>
+#include <TH2D.h>
 #include <TTree.h>
 #include <TSystem.h>
 #include <TTreeReader.h>
@@ -362,6 +368,74 @@ TEST(TreeProcessorMT, LimitNTasks_CheckClusters)
    gSystem->Unlink(filename);
 }
 
+TEST(TreeProcessorMT, SplitLargeClusters)
+{
+   const auto nEvents = 1000;
+   const auto filename = "TreeProcessorMT_SplitLargeClusters.root";
+   const auto treename = "t";
+   {
+      // a single cluster with many baskets, which are not aligned across branches
+      TFile file(filename, "recreate");
+      TTree t(treename, treename);
+      int v = 0;
+      double w = 0.;
+      t.Branch("v", &v)->SetBasketSize(128);
+      t.Branch("w", &w)->SetBasketSize(200);
+      for (; v < nEvents; ++v)
+         t.Fill();
+      t.Write();
+   }
+
+   // the entries at which both branches start a new basket
+   std::vector<Long64_t> boundaries;
+   {
+      TFile file(filename);
+      auto *t = file.Get<TTree>(treename);
+      auto *bv = t->GetBranch("v");
+      auto *bw = t->GetBranch("w");
+      const std::vector<Long64_t> vEntries(bv->GetBasketEntry(), bv->GetBasketEntry() + bv->GetWriteBasket());
+      const std::vector<Long64_t> wEntries(bw->GetBasketEntry(), bw->GetBasketEntry() + bw->GetWriteBasket());
+      std::set_intersection(vEntries.begin(), vEntries.end(), wEntries.begin(), wEntries.end(),
+                            std::back_inserter(boundaries));
+   }
+   ASSERT_GT(boundaries.size(), 2u);
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+   std::atomic<Long64_t> sum{0ll};
+   auto f = [&](TTreeReader &r) {
+      TTreeReaderValue<int> v(r, "v");
+      while (r.Next())
+         sum += *v;
+      std::lock_guard<std::mutex> l(m);
+      ranges.emplace_back(r.GetEntriesRange());
+   };
+
+   const unsigned int nslots = std::min(4U, std::thread::hardware_concurrency());
+   ROOT::EnableImplicitMT(nslots);
+
+   ROOT::TTreeProcessorMT p(filename, treename);
+   p.Process(f);
+
+   EXPECT_EQ(sum, nEvents * (nEvents - 1) / 2);
+   CheckClusters(ranges, nEvents);
+   // the single cluster is split, but only where no basket is shared between tasks
+   EXPECT_GT(ranges.size(), 1u);
+   for (const auto &range : ranges)
+      EXPECT_TRUE(std::binary_search(boundaries.begin(), boundaries.end(), range.first)) << range.first;
+
+   const auto &timings = p.GetTaskTimings();
+   EXPECT_EQ(timings.size(), ranges.size());
+   for (const auto &timing : timings) {
+      EXPECT_EQ(timing.fFileName, filename);
+      EXPECT_LT(timing.fStart, timing.fEnd);
+      EXPECT_GE(timing.fWallTime, 0.);
+   }
+
+   gSystem->Unlink(filename);
+   ROOT::DisableImplicitMT();
+}
+
 TEST(TreeProcessorMT, TreeWithFriendTree)
 {
    std::vector<std::string> fileNames = {"TreeWithFriendTree_Tree.root", "TreeWithFriendTree_Friend.root"};
@@ -518,3 +592,135 @@ TEST(TreeProcessorMT, TreesInSameFile)
    gSystem->Unlink(fname.c_str());
    ROOT::DisableImplicitMT();
 }
+
+void WriteDrawFile(const char *fname)
+{
+   TFile f(fname, "recreate");
+   TTree t("t", "t");
+   double x = 0;
+   int n = 0;
+   double arr[10];
+   t.Branch("x", &x);
+   t.Branch("n", &n);
+   t.Branch("arr", arr, "arr[n]/D");
+   t.SetAutoFlush(100);
+   std::mt19937 gen(42);
+   std::uniform_real_distribution<double> dist(0., 1.);
+   for (auto i = 0; i < 5000; ++i) {
+      x = dist(gen);
+      n = i % 10;
+      for (auto j = 0; j < n; ++j)
+         arr[j] = dist(gen);
+      t.Fill();
+   }
+   t.Write();
+}
+
+TEST(TreeProcessorMT, DrawAndProject)
+{
+   const auto fname = "treeprocmt_drawandproject.root";
+   WriteDrawFile(fname);
+
+   TFile f(fname);
+   auto t = f.Get<TTree>("t");
+   TH1D h1Seq("h1Seq", "", 20, 0, 1);
+   TH1D h1MT("h1MT", "", 20, 0, 1);
+   TH2D h2Seq("h2Seq", "", 10, 0, 1, 10, 0, 1);
+   TH2D h2MT("h2MT", "", 10, 0, 1, 10, 0, 1);
+
+   const auto n1Seq = t->Project("h1Seq", "arr", "x > 0.3");
+   const auto n2Seq = t->Project("h2Seq", "arr:x", "arr > 0.5");
+   t->Draw(">>elSeq", "x > 0.5 && n > 3", "entrylist");
+
+   ROOT::EnableImplicitMT(4);
+   const auto n1MT = t->Project("h1MT", "arr", "x > 0.3");
+   const auto n2MT = t->Project("h2MT", "arr:x", "arr > 0.5");
+   t->Draw(">>elMT", "x > 0.5 && n > 3", "entrylist");
+   ROOT::DisableImplicitMT();
+
+   EXPECT_EQ(n1Seq, n1MT);
+   EXPECT_EQ(n2Seq, n2MT);
+   EXPECT_EQ(h1Seq.GetEntries(), h1MT.GetEntries());
+   for (auto i = 0; i < h1Seq.GetNcells(); ++i)
+      EXPECT_DOUBLE_EQ(h1Seq.GetBinContent(i), h1MT.GetBinContent(i));
+   EXPECT_EQ(h2Seq.GetEntries(), h2MT.GetEntries());
+   for (auto i = 0; i < h2Seq.GetNcells(); ++i)
+      EXPECT_DOUBLE_EQ(h2Seq.GetBinContent(i), h2MT.GetBinContent(i));
+
+   auto elSeq = gDirectory->Get<TEntryList>("elSeq");
+   auto elMT = gDirectory->Get<TEntryList>("elMT");
+   ASSERT_NE(nullptr, elSeq);
+   ASSERT_NE(nullptr, elMT);
+   EXPECT_EQ(elSeq->GetN(), elMT->GetN());
+   for (auto i = 0; i < t->GetEntries(); ++i)
+      EXPECT_EQ(elSeq->Contains(i), elMT->Contains(i));
+
+   f.Close();
+   gSystem->Unlink(fname);
+}
+
+struct DrawResult {
+   Long64_t fNRows = 0;
+   std::vector<double> fBinContents;
+   std::vector<std::vector<double>> fValues; // the values of the variables, then the weights
+};
+
+DrawResult DrawAndCollect(TTree &t, const char *varexp, const char *selection, const char *hname, int dim)
+{
+   DrawResult result;
+   result.fNRows = t.Draw(varexp, selection, "goff");
+   auto h = gDirectory->Get<TH1>(hname);
+   if (h) {
+      for (auto i = 0; i < h->GetNcells(); ++i)
+         result.fBinContents.push_back(h->GetBinContent(i));
+   }
+   // The arrays hold the rows since the last multiple of the estimate
+   const auto nfill = result.fNRows % t.GetEstimate();
+   for (auto i = 0; i < dim; ++i)
+      result.fValues.emplace_back(t.GetVal(i), t.GetVal(i) + nfill);
+   result.fValues.emplace_back(t.GetW(), t.GetW() + nfill);
+   return result;
+}
+
+TEST(TreeProcessorMT, DrawNewHistograms)
+{
+   const auto fname = "treeprocmt_drawnewhistograms.root";
+   WriteDrawFile(fname);
+
+   TFile f(fname);
+   auto t = f.Get<TTree>("t");
+   // Smaller than the number of selected rows, such that the axis limits of htemp are estimated
+   // from the first entries and the arrays of the values are refilled several times
+   t->SetEstimate(1000);
+
+   struct Request {
+      const char *fVarexp;
+      const char *fSelection;
+      const char *fHistName;
+      int fDim;
+   };
+   const Request requests[] = {{"arr", "x > 0.3", "htemp", 1},
+                               {"x", "", "htemp", 1},
+                               {"x>>hbins(50,0,1)", "n > 2", "hbins", 1},
+                               {"arr:x", "arr > 0.5", "htemp", 2}};
+
+   std::vector<DrawResult> seq;
+   for (const auto &r : requests)
+      seq.emplace_back(DrawAndCollect(*t, r.fVarexp, r.fSelection, r.fHistName, r.fDim));
+   std::vector<DrawResult> mt;
+   ROOT::EnableImplicitMT(4);
+   for (const auto &r : requests)
+      mt.emplace_back(DrawAndCollect(*t, r.fVarexp, r.fSelection, r.fHistName, r.fDim));
+   ROOT::DisableImplicitMT();
+
+   for (auto i = 0u; i < seq.size(); ++i) {
+      SCOPED_TRACE(requests[i].fVarexp);
+      EXPECT_GT(seq[i].fNRows, t->GetEstimate());
+      EXPECT_EQ(seq[i].fNRows, mt[i].fNRows);
+      EXPECT_EQ(seq[i].fBinContents, mt[i].fBinContents);
+      EXPECT_EQ(seq[i].fValues, mt[i].fValues);
+   }
+
+   f.Close();
+   gSystem->Unlink(fname);
+}